@@ -15,6 +15,162 @@
 #include <cmath>
 #include <bit>						// bit_cast
 #include <stdexcept>
+#include <span>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+
+// with CXCM_RUNTIME_DISPATCH on x86-64, every batch kernel is compiled, with target pragmas, whatever the compiler flags,
+// and each batch function picks the best one for the cpu it is running on. otherwise the kernels are only the ones
+// the compiler flags allow.
+#if defined(CXCM_RUNTIME_DISPATCH) && (defined(__x86_64__) || defined(_M_X64))
+#define CXCM_DISPATCH
+#endif
+
+// with CXCM_AUTOTUNE, the tuned batch functions time each tier's kernels the first time they run, keep the fastest,
+// and remember it in a file for the next run (see batch::tuning_decisions()).
+#if defined(CXCM_AUTOTUNE)
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#endif
+
+// with CXCM_ENABLE_STATS, each thread counts the newton steps converging_sqrt() takes and the special values the
+// constexpr algorithms screen out when they run at runtime (see stats::snapshot()). without it, nothing is counted
+// and the counting compiles to nothing.
+// CXCM_ENABLE_PATH_STATS turns on CXCM_ENABLE_STATS, and also counts, for each function and type, how many values
+// went through std::, the cxcm algorithms, or each batch tier at runtime (see stats::path_report()).
+#if defined(CXCM_ENABLE_PATH_STATS) && !defined(CXCM_ENABLE_STATS)
+#define CXCM_ENABLE_STATS
+#endif
+
+#if defined(CXCM_ENABLE_STATS)
+#include <atomic>
+#include <mutex>
+#include <string>
+#define CXCM_STATS_COUNT(counter) do { if (!std::is_constant_evaluated()) ::cxcm::stats::detail::count(::cxcm::stats::detail::counter); } while (false)
+#define CXCM_STATS_SQRT_STEPS(T, steps) do { if (!std::is_constant_evaluated()) ::cxcm::stats::detail::count_sqrt_steps<T>(steps); } while (false)
+#else
+#define CXCM_STATS_COUNT(counter) ((void)0)
+#define CXCM_STATS_SQRT_STEPS(T, steps) ((void)0)
+#endif
+
+#if defined(CXCM_ENABLE_PATH_STATS)
+#define CXCM_STATS_PATH(function, T, path) do { if (!std::is_constant_evaluated()) ::cxcm::stats::detail::count_path<function, T, path>(); } while (false)
+#else
+#define CXCM_STATS_PATH(function, T, path) ((void)0)
+#endif
+
+#if defined(CXCM_DISPATCH) || defined(__SSE4_2__)
+#define CXCM_KERNELS_SSE4
+#endif
+#if defined(CXCM_DISPATCH) || defined(__F16C__)
+#define CXCM_KERNELS_F16C
+#endif
+#if defined(CXCM_DISPATCH) || defined(__AVX2__)
+#define CXCM_KERNELS_AVX2
+#endif
+#if defined(CXCM_DISPATCH) || (defined(__AVX2__) && defined(__FMA__))
+#define CXCM_KERNELS_FMA
+#endif
+#if defined(CXCM_DISPATCH) || defined(__AVX512F__)
+#define CXCM_KERNELS_AVX512
+#endif
+#if defined(CXCM_DISPATCH) || (defined(__AVX512F__) && defined(__AVX512DQ__))
+#define CXCM_KERNELS_AVX512DQ
+#endif
+
+// the instruction sets of each tier, for the kernels between CXCM_TARGET_*_BEGIN and CXCM_TARGET_END. msvc
+// always allows the intrinsics, so it needs nothing.
+#if defined(CXCM_DISPATCH) && defined(__clang__)
+#define CXCM_TARGET_SSE4_BEGIN _Pragma("clang attribute push (__attribute__((target(\"sse4.2,popcnt\"))), apply_to = function)")
+#define CXCM_TARGET_AVX2_BEGIN _Pragma("clang attribute push (__attribute__((target(\"avx2,fma,f16c,bmi,bmi2\"))), apply_to = function)")
+#define CXCM_TARGET_AVX512_BEGIN _Pragma("clang attribute push (__attribute__((target(\"avx512f,avx512dq,avx512bw,avx512vl,avx2,fma,f16c,bmi,bmi2\"))), apply_to = function)")
+#define CXCM_TARGET_END _Pragma("clang attribute pop")
+#define CXCM_FLATTEN __attribute__((flatten))
+#define CXCM_ALWAYS_INLINE __attribute__((always_inline)) inline
+#elif defined(CXCM_DISPATCH) && defined(__GNUC__)
+#define CXCM_TARGET_SSE4_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"sse4.2,popcnt\")")
+#define CXCM_TARGET_AVX2_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"avx2,fma,f16c,bmi,bmi2\")")
+#define CXCM_TARGET_AVX512_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f,avx512dq,avx512bw,avx512vl,avx2,fma,f16c,bmi,bmi2\")")
+#define CXCM_TARGET_END _Pragma("GCC pop_options")
+#define CXCM_FLATTEN __attribute__((flatten))
+#define CXCM_ALWAYS_INLINE __attribute__((always_inline)) inline
+#else
+#define CXCM_TARGET_SSE4_BEGIN
+#define CXCM_TARGET_AVX2_BEGIN
+#define CXCM_TARGET_AVX512_BEGIN
+#define CXCM_TARGET_END
+#define CXCM_FLATTEN
+#define CXCM_ALWAYS_INLINE inline
+#endif
+
+// a kernel written once against a tier's ops has no target of its own. it is always inlined into a wrapper that
+// has one, so gcc's notes about vector arguments changing the abi don't apply to it.
+#if defined(CXCM_DISPATCH) && defined(__GNUC__) && !defined(__clang__)
+#define CXCM_GENERIC_KERNEL_BEGIN _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wpsabi\"")
+#define CXCM_GENERIC_KERNEL_END _Pragma("GCC diagnostic pop")
+#else
+#define CXCM_GENERIC_KERNEL_BEGIN
+#define CXCM_GENERIC_KERNEL_END
+#endif
+
+#if defined(CXCM_KERNELS_SSE4) || defined(CXCM_KERNELS_F16C) || defined(CXCM_KERNELS_AVX2)
+#include <immintrin.h>
+#endif
+
+// MXCSR, for flush_denormals_scope
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#define CXCM_HAS_MXCSR
+#include <xmmintrin.h>
+#endif
+
+// cpuid and xgetbv, for picking the batch kernels at runtime
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if defined(__has_include)
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
+#endif
+
+// IEEE 754 binary128 as __float128, on gcc and clang for most 64-bit targets. define CXCM_NO_FLOAT128 to turn off.
+#if defined(__SIZEOF_FLOAT128__) && !defined(CXCM_NO_FLOAT128)
+#define CXCM_HAS_FLOAT128
+#endif
+
+// the runtime versions of the binary128 functions call libquadmath when CXCM_USE_QUADMATH is defined, which
+// needs -lquadmath
+#if defined(CXCM_HAS_FLOAT128) && defined(CXCM_USE_QUADMATH)
+#include <quadmath.h>
+#endif
+
+// C++23 made the rounding and classification functions of <cmath> constexpr, and C++26 most of the rest
+#if defined(__cpp_lib_constexpr_cmath) && (__cpp_lib_constexpr_cmath >= 202202L)
+#define CXCM_CONSTEXPR_CMATH_23
+#endif
+
+#if defined(__cpp_lib_constexpr_cmath) && (__cpp_lib_constexpr_cmath >= 202306L)
+#define CXCM_CONSTEXPR_CMATH_26
+#endif
+
+// gcc folds its math builtins in constant expressions, correctly rounded by MPFR, with the same bits as the cxcm
+// algorithms. define CXCM_NO_CONSTEXPR_BUILTINS to always use the cxcm algorithms.
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_LLVM_COMPILER) && !defined(CXCM_NO_CONSTEXPR_BUILTINS)
+#define CXCM_CONSTEXPR_BUILTINS
+#endif
 
 //
 // ConstXpr CMath -- cxcm
@@ -106,6 +262,16 @@ namespace cxcm
 		// The following code computes fl(a x b) and error(a x b).
 		constexpr double two_prod(double a, double b, double &error) noexcept
 		{
+#if defined(__FMA__)
+			// with fma available the compiler may contract the split arithmetic below, which is no longer exact
+			if (!std::is_constant_evaluated())
+			{
+				const double p = a * b;
+				error = std::fma(a, b, -p);
+				return p;
+			}
+#endif
+
 			double a_high = 0.0;
 			double a_low = 0.0;
 			double b_high = 0.0;
@@ -354,1219 +520,8784 @@ namespace cxcm
 
 	} // namespace dd_real
 
-	namespace concepts
-	{
-		template <typename T>
-		concept basic_floating_point = (std::is_same_v<float, std::remove_cvref_t<T>> || std::is_same_v<double, std::remove_cvref_t<T>>);
-
-	}	// namespace concepts
+	//
+	// 16-bit floating-point storage types
+	//
 
-	namespace limits
+	// IEEE 754 binary16: 1 sign bit, 5 exponent bits, 10 significand bits
+	struct float16
 	{
-		namespace detail
-		{
-			// long doubles vary between compilers and platforms. Windows MSVC and clang on Windows both use
-			// the same representation as double. For gcc and linux, etc., it is often represented by an extended
-			// precision data structure with 80 bits (64 bits of significand). sizeof(long double) on gcc on Windows
-			// (at least MSYS2) is 16, implying it is 128 bits, but std::numeric_limits<long double> returns values
-			// consistent with an 80 bit representation.
-			constexpr long double get_largest_fractional_long_double() noexcept
-			{
-				if constexpr (std::numeric_limits<long double>::digits == 64)
-				{
-					// if digits is 64, then long double is using extended precision, and we can
-					// just barely get away with casting to a long long to remove the fractional
-					// part and keep the rest of the bits, without overflow.
-					return 0x1.fffffffffffffffep+62L;
-				}
-				else
-				{
-					// assuming that long double does the same thing as double (which is true for
-					// MSVC and clang on windows).
-					return 0x1.fffffffffffffp+51L;
-				}
-			}
+		std::uint16_t bits = 0;
 
-			}	// namespace detail
+		static constexpr std::uint16_t sign_mask = 0x8000;
+		static constexpr std::uint16_t exponent_mask = 0x7C00;
+		static constexpr std::uint16_t significand_mask = 0x03FF;
 
-		//
-		// largest_fractional_value
-		//
+		constexpr float16() noexcept = default;
 
-		// the largest floating point value that has a fractional representation
+		// round to nearest, ties to even
+		explicit constexpr float16(float value) noexcept;
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr inline T largest_fractional_value = T();
+		// rounded once, not through float
+		explicit constexpr float16(double value) noexcept;
 
-		template <>
-		constexpr inline double largest_fractional_value<double> = 0x1.fffffffffffffp+51;
+#if defined(__STDCPP_FLOAT16_T__)
+		explicit constexpr float16(std::float16_t value) noexcept : bits(std::bit_cast<std::uint16_t>(value))
+		{
+		}
 
-		template <>
-		constexpr inline float largest_fractional_value<float> = 0x1.fffffep+22f;
+		explicit constexpr operator std::float16_t() const noexcept
+		{
+			return std::bit_cast<std::float16_t>(bits);
+		}
+#endif
 
-		}	// namespace limits
+		static constexpr float16 from_bits(std::uint16_t value) noexcept
+		{
+			float16 result;
+			result.bits = value;
+			return result;
+		}
 
-	//
-	// floating-point negative zero support
-	//
+		// exact, every float16 value is representable as a float
+		explicit constexpr operator float() const noexcept
+		{
+			const unsigned int sign = static_cast<unsigned int>(bits & 0x8000) << 16;
+			const unsigned int exponent = (bits >> 10) & 0x1F;
+			const unsigned int significand = bits & 0x03FF;
 
-	template <cxcm::concepts::basic_floating_point T>
-	constexpr bool is_negative_zero(T) noexcept
-	{
-		return false;
-	}
+			if (exponent == 0)
+			{
+				// zero or subnormal, significand * 2^-24 is exact in float
+				const float magnitude = static_cast<float>(significand) * 0x1.0p-24f;
+				return std::bit_cast<float>(std::bit_cast<unsigned int>(magnitude) | sign);
+			}
+			else if (exponent == 0x1F)
+			{
+				// infinity or NaN, keeping the payload
+				return std::bit_cast<float>(sign | 0x7F800000 | (significand << 13));
+			}
 
-	template<>
-	constexpr bool is_negative_zero(float val) noexcept
-	{
-		return (0x80000000 == std::bit_cast<unsigned int>(val));
-	}
+			return std::bit_cast<float>(sign | ((exponent - 15 + 127) << 23) | (significand << 13));
+		}
+	};
 
-	template<>
-	constexpr bool is_negative_zero(double val) noexcept
+	// bfloat16: 1 sign bit, 8 exponent bits, 7 significand bits -- the upper half of a float
+	struct bfloat16
 	{
-		return (0x8000000000000000 == std::bit_cast<unsigned long long>(val));
-	}
-
-	template <cxcm::concepts::basic_floating_point T>
-	constexpr inline T negative_zero = T(-0);
+		std::uint16_t bits = 0;
 
-	template <>
-	constexpr inline float negative_zero<float> = std::bit_cast<float>(0x80000000);
+		static constexpr std::uint16_t sign_mask = 0x8000;
+		static constexpr std::uint16_t exponent_mask = 0x7F80;
+		static constexpr std::uint16_t significand_mask = 0x007F;
 
-	template <>
-	constexpr inline double negative_zero<double> = std::bit_cast<double>(0x8000000000000000);
+		constexpr bfloat16() noexcept = default;
 
-	// don't worry about esoteric input.
-	// much faster than strict or standard when non constant evaluated,
-	// though standard library is a little better in debugger.
-	namespace relaxed
-	{
-		//
-		// abs(), fabs()
-		//
+		// round to nearest, ties to even
+		explicit constexpr bfloat16(float value) noexcept;
 
-		// absolute value
+		// rounded once, not through float
+		explicit constexpr bfloat16(double value) noexcept;
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T abs(T value) noexcept
+#if defined(__STDCPP_BFLOAT16_T__)
+		explicit constexpr bfloat16(std::bfloat16_t value) noexcept : bits(std::bit_cast<std::uint16_t>(value))
 		{
-			return (value < T(0)) ? -value : value;
 		}
 
-		// undefined behavior if value is std::numeric_limits<T>::min()
-		template <std::signed_integral T>
-		constexpr T abs(T value) noexcept
+		explicit constexpr operator std::bfloat16_t() const noexcept
 		{
-			return (value < T(0)) ? -value : value;
+			return std::bit_cast<std::bfloat16_t>(bits);
 		}
+#endif
 
-		template <std::unsigned_integral T>
-		constexpr T abs(T value) noexcept
+		static constexpr bfloat16 from_bits(std::uint16_t value) noexcept
 		{
-			return value;
+			bfloat16 result;
+			result.bits = value;
+			return result;
 		}
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T fabs(T value) noexcept
+		// exact, every bfloat16 value is representable as a float
+		explicit constexpr operator float() const noexcept
 		{
-			return abs(value);
+			return std::bit_cast<float>(static_cast<unsigned int>(bits) << 16);
 		}
+	};
 
-		template <std::integral T>
-		constexpr double fabs(T value) noexcept
-		{
-			return abs(value);
-		}
+	static_assert(sizeof(float16) == 2);
+	static_assert(sizeof(bfloat16) == 2);
+
+	//
+	// bit-level helpers
+	//
 
+	namespace bitwise
+	{
 		//
-		// trunc()
+		// uint128
 		//
 
-		// this is the workhorse function for floor(), ceil(), and round().
-
-		// rounds towards zero
+		// 128-bit unsigned integer built from two 64-bit words, since not every compiler has one
+		struct uint128
+		{
+			std::uint64_t high = 0;
+			std::uint64_t low = 0;
+		};
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T trunc(T value) noexcept
+		constexpr bool operator ==(const uint128 &a, const uint128 &b) noexcept
 		{
-			return static_cast<T>(static_cast<long long>(value));
+			return (a.high == b.high) && (a.low == b.low);
 		}
 
-		// float specialization
-		template <>
-		constexpr float trunc(float value) noexcept
+		constexpr bool operator <(const uint128 &a, const uint128 &b) noexcept
 		{
-			return static_cast<float>(static_cast<int>(value));
+			return (a.high < b.high) || ((a.high == b.high) && (a.low < b.low));
 		}
 
-		//
-		// floor()
-		//
-
-		// rounds towards negative infinity
-
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T floor(T value) noexcept
+		constexpr bool operator >=(const uint128 &a, const uint128 &b) noexcept
 		{
-			const T truncated_value = trunc(value);
-
-			// truncation rounds to zero which is right direction for positive values,
-			// but we need to go the other way for negative values.
+			return !(a < b);
+		}
 
-			// negative non-integral value
-			if (truncated_value > value)
-				return (truncated_value - T(1.0f));
+		constexpr uint128 operator -(const uint128 &a, const uint128 &b) noexcept
+		{
+			return uint128{a.high - b.high - ((a.low < b.low) ? 1 : 0), a.low - b.low};
+		}
 
-			// positive or integral value
-			return truncated_value;
+		constexpr uint128 operator |(const uint128 &a, std::uint64_t b) noexcept
+		{
+			return uint128{a.high, a.low | b};
 		}
 
-		//
-		// ceil()
-		//
+		constexpr uint128 operator +(const uint128 &a, const uint128 &b) noexcept
+		{
+			const std::uint64_t low = a.low + b.low;
+			return uint128{a.high + b.high + ((low < a.low) ? 1 : 0), low};
+		}
 
-		// rounds towards positive infinity
+		constexpr uint128 operator |(const uint128 &a, const uint128 &b) noexcept
+		{
+			return uint128{a.high | b.high, a.low | b.low};
+		}
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T ceil(T value) noexcept
+		constexpr uint128 operator &(const uint128 &a, const uint128 &b) noexcept
 		{
-			const T truncated_value = trunc(value);
+			return uint128{a.high & b.high, a.low & b.low};
+		}
 
-			// truncation rounds to zero which is right direction for negative values,
-			// but we need to go the other way for positive values.
+		constexpr uint128 operator ~(const uint128 &a) noexcept
+		{
+			return uint128{~a.high, ~a.low};
+		}
 
-			// positive non-integral value
-			if (truncated_value < value)
-				return (truncated_value + T(1.0f));
+		// shift in [0, 127]
+		constexpr uint128 operator <<(const uint128 &a, int shift) noexcept
+		{
+			if (shift == 0)
+				return a;
+			else if (shift >= 64)
+				return uint128{a.low << (shift - 64), 0};
 
-			// negative or integral value
-			return truncated_value;
+			return uint128{(a.high << shift) | (a.low >> (64 - shift)), a.low << shift};
 		}
 
-		//
-		// round()
-		//
+		// shift in [0, 127]
+		constexpr uint128 operator >>(const uint128 &a, int shift) noexcept
+		{
+			if (shift == 0)
+				return a;
+			else if (shift >= 64)
+				return uint128{0, a.high >> (shift - 64)};
 
-		// rounds to nearest integral position, halfway cases away from zero
+			return uint128{a.high >> shift, (a.low >> shift) | (a.high << (64 - shift))};
+		}
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T round(T value) noexcept
+		// 64 x 64 -> 128 bit product, from 32-bit pieces
+		constexpr uint128 multiply(std::uint64_t a, std::uint64_t b) noexcept
 		{
-			// zero could be handled either place, but here it is with the negative values.
+			const std::uint64_t low_low = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+			const std::uint64_t high_low = (a >> 32) * (b & 0xFFFFFFFF);
+			const std::uint64_t low_high = (a & 0xFFFFFFFF) * (b >> 32);
+			const std::uint64_t high_high = (a >> 32) * (b >> 32);
 
-			// positive value, taking care of halfway case.
-			if (value > T(0))
-				return trunc(value + T(0.5f));
+			// can't overflow, at most 2 * (2^32 - 1) + (2^32 - 1)^2 = 2^64 - 1
+			const std::uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
 
-			// negative or zero value, taking care of halfway case.
-			return trunc(value - T(0.5f));
+			return uint128{high_high + (high_low >> 32) + (middle >> 32), (middle << 32) | (low_low & 0xFFFFFFFF)};
 		}
 
 		//
-		// fract() - not in standard library
+		// uint256
 		//
 
-		// the fractional part of a floating point number - always non-negative.
+		struct uint256
+		{
+			uint128 high;
+			uint128 low;
+		};
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T fract(T value) noexcept
+		constexpr bool operator <(const uint256 &a, const uint256 &b) noexcept
 		{
-			return value - floor(value);
+			return (a.high < b.high) || ((a.high == b.high) && (a.low < b.low));
 		}
 
-		//
-		// fmod()
-		//
-
-		// the floating point remainder of division
+		constexpr uint256 operator +(const uint256 &a, const uint256 &b) noexcept
+		{
+			const uint128 low = a.low + b.low;
+			return uint256{a.high + b.high + uint128{0, (low < a.low) ? 1u : 0u}, low};
+		}
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T fmod(T x, T y) noexcept
+		// for a < 2^127
+		constexpr uint256 square(const uint128 &a) noexcept
 		{
-			return x - trunc(x / y) * y;
+			const uint128 cross = multiply(a.high, a.low) << 1;
+			return uint256{multiply(a.high, a.high), multiply(a.low, a.low)} + uint256{cross >> 64, cross << 64};
 		}
 
 		//
-		// round_even() - not in standard library
+		// sqrt_with_remainder()
 		//
 
-		// rounds to nearest integral position, halfway cases towards even
+		// restoring digit-by-digit square root, two bits of the radicand per step, always 64 steps.
+		// root is floor(sqrt(radicand)), and radicand == root * root + remainder.
+		struct sqrt_result
+		{
+			std::uint64_t root = 0;
+			uint128 remainder;
+		};
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T round_even(T value) noexcept
+		constexpr sqrt_result sqrt_with_remainder(uint128 radicand) noexcept
 		{
-			T trunc_value = trunc(value);
-			bool is_even = (fmod(trunc_value, T(2)) == T(0));
-			bool is_halfway = (fract(value) == T(0.5));
+			uint128 remainder;
+			uint128 root;
 
-			// the special case
-			if (is_halfway && is_even)
-				return trunc_value;
+			for (int i = 0; i < 64; ++i)
+			{
+				remainder = (remainder << 2) | ((radicand >> 126).low);
+				radicand = radicand << 2;
 
-			// zero could be handled either place, but here it is with the negative values.
+				const uint128 trial = (root << 2) | 1;
+				root = root << 1;
 
-			// positive value, taking care of halfway case.
-			if (value > T(0))
-				return trunc(value + T(0.5f));
+				if (remainder >= trial)
+				{
+					remainder = remainder - trial;
+					root = root | 1;
+				}
+			}
 
-			// negative or zero value, taking care of halfway case.
-			return trunc(value - T(0.5f));
+			return sqrt_result{root.low, remainder};
 		}
 
 		//
-		// sqrt()
+		// 80-bit extended precision long double
 		//
 
-		namespace detail
+		// the x87 format: a 64-bit significand with an explicit integer bit, then 15 exponent bits and the sign,
+		// stored little endian in the first 10 bytes and padded out to sizeof(long double).
+		constexpr bool is_x87_long_double = (std::numeric_limits<long double>::digits == 64) &&
+											(std::numeric_limits<long double>::max_exponent == 16384) &&
+											(sizeof(long double) > 10) && (std::endian::native == std::endian::little);
+
+		// long double that is really just a double, e.g., MSVC
+		constexpr bool is_double_long_double = (std::numeric_limits<long double>::digits == 53) && (sizeof(long double) == sizeof(double));
+
+		struct x87_bits
 		{
-			// "Improving the Accuracy of the Fast Inverse Square Root by Modifying Newton-Raphson Corrections" 2021
-			// https://www.mdpi.com/1099-4300/23/1/86
-			//
-			// in comparison to inverse_sqrt(double), this method gives pretty good results:
-			//    0 ulps: ~68.58%
-			//    1 ulps: ~31.00%
-			//    2 ulps:  ~0.42%
-			//
-			// depending on compiler/platform, this may not be faster than rsqrt()
-			constexpr double fast_rsqrt(double x) noexcept
-			{
-				double halfx = 0.5 * x;
-				long long i = std::bit_cast<long long>(x);
-				i = 0x5FE6ED2102DCBFDA - (i >> 1);
-				double y = std::bit_cast<double>(i);
-				y *= 1.50087895511633457 - halfx * y * y;
-				y *= 1.50000057967625766 - halfx * y * y;
-				y *= 1.5000000000002520 - halfx * y * y;
-				y *= 1.5000000000000000 - halfx * y * y;
-				return y;
-			}
+			std::uint64_t significand = 0;
+			std::uint16_t sign_exponent = 0;
+			unsigned char padding[is_x87_long_double ? (sizeof(long double) - 10) : 6]{};
+		};
 
-			// float uses double internally, double uses dd_real internally
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T converging_sqrt(T arg) noexcept
-			{
-				const double boosted_arg = arg;
-				double init_value = boosted_arg * fast_rsqrt(boosted_arg);
+		constexpr std::uint16_t x87_sign_mask = 0x8000;
+		constexpr std::uint16_t x87_exponent_mask = 0x7FFF;
+		constexpr int x87_exponent_bias = 16383;
+		constexpr std::uint64_t x87_integer_bit = 0x8000000000000000;
+		constexpr std::uint64_t x87_quiet_bit = 0x4000000000000000;
 
-				if constexpr (std::is_same_v<T, double>)
-				{
-					// boosted_arg doesn't need to be a dd_real for [T = double]
+		// templates so they are only instantiated where long double really is the x87 format
 
-					auto current_value = dd_real::dd_real(init_value);
-					auto previous_value = dd_real::dd_real(0.0);
+		template <std::same_as<long double> T>
+		constexpr x87_bits to_x87_bits(T value) noexcept
+		{
+			return std::bit_cast<x87_bits>(value);
+		}
 
-					while ((current_value[0] != previous_value[0]) && (current_value[0] * current_value[0] != boosted_arg))
-					{
-						previous_value = current_value;
-						current_value = 0.5 * (current_value + (boosted_arg / current_value));
-					}
+		template <std::same_as<long double> T = long double>
+		constexpr T from_x87_bits(std::uint64_t significand, std::uint16_t sign_exponent) noexcept
+		{
+			x87_bits bits;
+			bits.significand = significand;
+			bits.sign_exponent = sign_exponent;
 
-					return static_cast<double>(current_value);
-				}
-				else if constexpr (std::is_same_v<T, float>)
-				{
-					double current_value = init_value;
-					double previous_value = 0.0;
+			return std::bit_cast<T>(bits);
+		}
 
-					while ((current_value != previous_value) && (current_value * current_value != boosted_arg))
-					{
-						previous_value = current_value;
-						current_value = 0.5 * (current_value + (boosted_arg / current_value));
-					}
+		//
+		// 16-bit floating-point rounding
+		//
 
-					return static_cast<float>(current_value);
-				}
-			}
+		// float to binary16, round to nearest ties to even. NaNs are quieted and keep the top of their payload,
+		// the same as the F16C instructions.
+		constexpr std::uint16_t float16_bits(float value) noexcept
+		{
+			const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+			const std::uint16_t sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000);
+			const std::uint32_t magnitude = bits & 0x7FFFFFFF;
 
-			// float uses double internally, double uses dd_real internally
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T inverse_sqrt(T arg) noexcept
+			// infinity or NaN
+			if (magnitude >= 0x7F800000)
+				return sign | ((magnitude > 0x7F800000) ? static_cast<std::uint16_t>(0x7E00 | ((magnitude >> 13) & 0x03FF)) : std::uint16_t(0x7C00));
+
+			// 65520 and above round to infinity
+			if (magnitude >= 0x477FF000)
+				return sign | std::uint16_t(0x7C00);
+
+			// below 2^-14 the result is subnormal, a multiple of 2^-24
+			if (magnitude < 0x38800000)
 			{
-				// don't need this to be a dd_real
-				const double boosted_arg = arg;
+				// at most half of the smallest subnormal rounds to zero
+				if (magnitude <= 0x33000000)
+					return sign;
 
-				if constexpr (std::is_same_v<T, double>)
-				{
-					// arg is already a double
-					auto current_value = dd_real::dd_real(fast_rsqrt(arg));
+				const std::uint32_t significand = (magnitude & 0x007FFFFF) | 0x00800000;
+				const int shift = 126 - static_cast<int>(magnitude >> 23);
+				const std::uint32_t halfway = std::uint32_t(1) << (shift - 1);
+				const std::uint32_t rest = significand & ((std::uint32_t(1) << shift) - 1);
+				std::uint32_t result = significand >> shift;
 
-					current_value *= (1.5 - ((0.5 * boosted_arg) * (current_value * current_value)));
+				if ((rest > halfway) || ((rest == halfway) && (result & 1)))
+					++result;
 
-					return static_cast<double>(current_value);
-				}
-				else if constexpr (std::is_same_v<T, float>)
-				{
-					double current_value = fast_rsqrt(boosted_arg);
+				return sign | static_cast<std::uint16_t>(result);
+			}
 
-					current_value *= (1.5 - (0.5 * boosted_arg * current_value * current_value));
+			// rebias the exponent, a carry out of the significand correctly bumps the exponent
+			const std::uint32_t rounded = magnitude + 0x0FFF + ((magnitude >> 13) & 1);
+			return sign | static_cast<std::uint16_t>((rounded - (112u << 23)) >> 13);
+		}
 
-					// do a couple more refinements for floating point (this needs testing to see if necessary)
-					current_value *= (1.5 - (0.5 * boosted_arg * current_value * current_value));
-					current_value *= (1.5 - (0.5 * boosted_arg * current_value * current_value));
+		// float to bfloat16, round to nearest ties to even. NaNs are quieted.
+		constexpr std::uint16_t bfloat16_bits(float value) noexcept
+		{
+			const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
 
-					return static_cast<float>(current_value);
-				}
-			}
+			if ((bits & 0x7FFFFFFF) > 0x7F800000)
+				return static_cast<std::uint16_t>((bits >> 16) | 0x0040);
 
-		}	// namespace detail
+			return static_cast<std::uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+		}
 
-		// constexpr square root, uses higher precision behind the scenes
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T sqrt(T value) noexcept
+		// double to float, rounding to odd. with at least two more bits than the final format, a second rounding
+		// to nearest gives the same result as rounding the double directly.
+		constexpr float round_to_odd_float(double value) noexcept
 		{
-			return detail::converging_sqrt(value);
+			const float result = static_cast<float>(value);
+
+			if ((static_cast<double>(result) == value) || (value != value))
+				return result;
+
+			std::uint32_t bits = std::bit_cast<std::uint32_t>(result);
+
+			// step back toward zero if rounding went away from zero
+			if ((static_cast<double>(result) > value) == (value > 0))
+				--bits;
+
+			return std::bit_cast<float>(bits | 1);
 		}
 
-		// reciprocal of square root, uses higher precision behind the scenes
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T rsqrt(T value) noexcept
+		//
+		// binary128 bit access
+		//
+
+		// 1 sign bit, 15 exponent bits, and 112 stored significand bits
+		constexpr std::uint64_t quad_sign_mask = 0x8000000000000000;
+		constexpr std::uint64_t quad_exponent_mask = 0x7FFF000000000000;
+		constexpr std::uint64_t quad_significand_mask = 0x0000FFFFFFFFFFFF;
+		constexpr int quad_exponent_bias = 16383;
+
+		template <typename T>
+		constexpr uint128 to_quad_bits(T value) noexcept
 		{
-			return detail::inverse_sqrt(value);
+			const auto words = std::bit_cast<std::array<std::uint64_t, 2>>(value);
+
+			if constexpr (std::endian::native == std::endian::little)
+				return uint128{words[1], words[0]};
+			else
+				return uint128{words[0], words[1]};
 		}
 
-		// fast reciprocal of square root
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T fast_rsqrt(T value) noexcept
+		template <typename T>
+		constexpr T from_quad_bits(const uint128 &bits) noexcept
 		{
-			return static_cast<T>(detail::fast_rsqrt(static_cast<double>(value)));
+			if constexpr (std::endian::native == std::endian::little)
+				return std::bit_cast<T>(std::array<std::uint64_t, 2>{bits.low, bits.high});
+			else
+				return std::bit_cast<T>(std::array<std::uint64_t, 2>{bits.high, bits.low});
 		}
 
-	} // namespace relaxed
+	}	// namespace bitwise
 
-	//
-	// isnan()
-	//
+	constexpr float16::float16(float value) noexcept : bits(bitwise::float16_bits(value))
+	{
+	}
 
-	// make sure this isn't optimized away if used with fast-math
+	constexpr float16::float16(double value) noexcept : bits(bitwise::float16_bits(bitwise::round_to_odd_float(value)))
+	{
+	}
 
-#if defined(_MSC_VER) || defined(__clang__) || defined(__INTEL_LLVM_COMPILER)
-#pragma float_control(precise, on, push)
-#endif
+	constexpr bfloat16::bfloat16(float value) noexcept : bits(bitwise::bfloat16_bits(value))
+	{
+	}
 
-	template <cxcm::concepts::basic_floating_point T>
-#if defined(__GNUC__) && !defined(__clang__)
-	__attribute__((optimize("-fno-fast-math")))
-#endif
-	constexpr bool isnan(T value) noexcept
+	constexpr bfloat16::bfloat16(double value) noexcept : bits(bitwise::bfloat16_bits(bitwise::round_to_odd_float(value)))
 	{
-		return (value != value);
 	}
 
-#if defined(_MSC_VER) || defined(__clang__) || defined(__INTEL_LLVM_COMPILER)
-#pragma float_control(pop)
+	namespace concepts
+	{
+		template <typename T>
+		concept basic_floating_point = (std::is_same_v<float, std::remove_cvref_t<T>> || std::is_same_v<double, std::remove_cvref_t<T>> ||
+										(std::is_same_v<long double, std::remove_cvref_t<T>> && (bitwise::is_x87_long_double || bitwise::is_double_long_double)));
+
+		// storage only 16-bit floating-point types
+		template <typename T>
+		concept half_floating_point = (std::is_same_v<cxcm::float16, std::remove_cvref_t<T>> || std::is_same_v<cxcm::bfloat16, std::remove_cvref_t<T>>);
+
+		// IEEE 754 binary128, when the compiler has it
+		template <typename T>
+		concept quad_floating_point =
+#if defined(CXCM_HAS_FLOAT128)
+			std::is_same_v<__float128, std::remove_cvref_t<T>> ||
+#endif
+#if defined(__STDCPP_FLOAT128_T__)
+			std::is_same_v<std::float128_t, std::remove_cvref_t<T>> ||
 #endif
+			false;
 
-	template <std::integral T>
-	constexpr bool isnan(T value) noexcept
+		// C++23 extended floating-point types with the same format as float or double
+		template <typename T>
+		concept extended_floating_point =
+#if defined(__STDCPP_FLOAT32_T__)
+			std::is_same_v<std::float32_t, std::remove_cvref_t<T>> ||
+#endif
+#if defined(__STDCPP_FLOAT64_T__)
+			std::is_same_v<std::float64_t, std::remove_cvref_t<T>> ||
+#endif
+			false;
+
+	}	// namespace concepts
+
+	// float or double, whichever has the same format as the extended floating-point type. converting between
+	// them is exact and costs nothing.
+	template <cxcm::concepts::extended_floating_point T>
+	using standard_floating_point_t = std::conditional_t<(sizeof(std::remove_cvref_t<T>) == sizeof(float)), float, double>;
+
+	namespace limits
 	{
-		return isnan(static_cast<double>(value));
-	}
+		namespace detail
+		{
+			// long doubles vary between compilers and platforms. Windows MSVC and clang on Windows both use
+			// the same representation as double. For gcc and linux, etc., it is often represented by an extended
+			// precision data structure with 80 bits (64 bits of significand). sizeof(long double) on gcc on Windows
+			// (at least MSYS2) is 16, implying it is 128 bits, but std::numeric_limits<long double> returns values
+			// consistent with an 80 bit representation.
+			constexpr long double get_largest_fractional_long_double() noexcept
+			{
+				if constexpr (std::numeric_limits<long double>::digits == 64)
+				{
+					// if digits is 64, then long double is using extended precision, and we can
+					// just barely get away with casting to a long long to remove the fractional
+					// part and keep the rest of the bits, without overflow.
+					return 0x1.fffffffffffffffep+62L;
+				}
+				else
+				{
+					// assuming that long double does the same thing as double (which is true for
+					// MSVC and clang on windows).
+					return 0x1.fffffffffffffp+51L;
+				}
+			}
 
-	//
-	// isinf()
-	//
+			}	// namespace detail
 
-	// make sure this isn't optimized away if used with fast-math
+		//
+		// largest_fractional_value
+		//
 
-#if defined(_MSC_VER) || defined(__clang__) || defined(__INTEL_LLVM_COMPILER)
-#pragma float_control(precise, on, push)
+		// the largest floating point value that has a fractional representation
+
+		template <typename T>
+		requires (cxcm::concepts::basic_floating_point<T> || cxcm::concepts::quad_floating_point<T> || cxcm::concepts::extended_floating_point<T>)
+		constexpr inline T largest_fractional_value = T();
+
+		template <>
+		constexpr inline double largest_fractional_value<double> = 0x1.fffffffffffffp+51;
+
+		template <>
+		constexpr inline float largest_fractional_value<float> = 0x1.fffffep+22f;
+
+		template <>
+		constexpr inline long double largest_fractional_value<long double> = detail::get_largest_fractional_long_double();
+
+#if defined(CXCM_HAS_FLOAT128)
+		template <>
+		constexpr inline __float128 largest_fractional_value<__float128> = static_cast<__float128>(0x1.0p+112) - static_cast<__float128>(0.5);
 #endif
 
-	template <cxcm::concepts::basic_floating_point T>
-#if defined(__GNUC__) && !defined(__clang__)
-	__attribute__((optimize("-fno-fast-math")))
+#if defined(__STDCPP_FLOAT128_T__)
+		template <>
+		constexpr inline std::float128_t largest_fractional_value<std::float128_t> = static_cast<std::float128_t>(0x1.0p+112) - static_cast<std::float128_t>(0.5);
 #endif
-	constexpr bool isinf(T value) noexcept
-	{
-		return (value == -std::numeric_limits<T>::infinity()) || (value == std::numeric_limits<T>::infinity());
-	}
 
-#if defined(_MSC_VER) || defined(__clang__) || defined(__INTEL_LLVM_COMPILER)
-#pragma float_control(pop)
+#if defined(__STDCPP_FLOAT32_T__)
+		template <>
+		constexpr inline std::float32_t largest_fractional_value<std::float32_t> = static_cast<std::float32_t>(largest_fractional_value<float>);
 #endif
 
-	template <std::integral T>
-	constexpr bool isinf(T value) noexcept
-	{
-		return isinf(static_cast<double>(value));
-	}
+#if defined(__STDCPP_FLOAT64_T__)
+		template <>
+		constexpr inline std::float64_t largest_fractional_value<std::float64_t> = static_cast<std::float64_t>(largest_fractional_value<double>);
+#endif
+
+		}	// namespace limits
 
 	//
-	// fpclassify()
+	// floating-point negative zero support
 	//
 
 	template <cxcm::concepts::basic_floating_point T>
-	constexpr int fpclassify(T value) noexcept
+	constexpr bool is_negative_zero(T) noexcept
 	{
-		if (isnan(value))
-			return FP_NAN;
-		else if (isinf(value))
-			return FP_INFINITE;
-		else if (value == 0)				// intentional use of the implicit cast of 0 to T.
-			return FP_ZERO;
-		else if (relaxed::abs(value) < std::numeric_limits<T>::min())
-			return FP_SUBNORMAL;
-
-		return FP_NORMAL;
+		return false;
 	}
 
-	template <std::integral T>
-	constexpr int fpclassify(T value) noexcept
+	template<>
+	constexpr bool is_negative_zero(float val) noexcept
 	{
-		return fpclassify(static_cast<double>(value));
+		return (0x80000000 == std::bit_cast<unsigned int>(val));
 	}
 
-	//
-	// isnormal()
-	//
-
-	template <cxcm::concepts::basic_floating_point T>
-	constexpr bool isnormal(T value) noexcept
+	template<>
+	constexpr bool is_negative_zero(double val) noexcept
 	{
-		return (fpclassify(value) == FP_NORMAL);
+		return (0x8000000000000000 == std::bit_cast<unsigned long long>(val));
 	}
 
-	template <std::integral T>
-	constexpr bool isnormal(T value) noexcept
+	template <cxcm::concepts::extended_floating_point T>
+	constexpr bool is_negative_zero(T val) noexcept
 	{
-		return isnormal(static_cast<double>(value));
+		return is_negative_zero(static_cast<standard_floating_point_t<T>>(val));
 	}
 
-	//
-	// isfinite()
-	//
+	template <typename T>
+	requires (cxcm::concepts::basic_floating_point<T> || cxcm::concepts::extended_floating_point<T>)
+	constexpr inline T negative_zero = T(-0);
 
-	template <cxcm::concepts::basic_floating_point T>
-	constexpr bool isfinite(T value) noexcept
-	{
-		return !isnan(value) && !isinf(value);
-	}
+	template <>
+	constexpr inline float negative_zero<float> = std::bit_cast<float>(0x80000000);
 
-	template <std::integral T>
-	constexpr bool isfinite(T value) noexcept
-	{
-		return isfinite(static_cast<double>(value));
-	}
+	template <>
+	constexpr inline double negative_zero<double> = std::bit_cast<double>(0x8000000000000000);
 
-	//
-	// signbit()
-	//
+	template <>
+	constexpr inline long double negative_zero<long double> = -0.0L;
 
-	// +0 returns false and -0 returns true
-	template <cxcm::concepts::basic_floating_point T>
-	constexpr bool signbit(T value) noexcept
-	{
-		if constexpr (sizeof(T) == 4)
-		{
-			unsigned int bits = std::bit_cast<unsigned int>(value);
-			return (bits & 0x80000000) != 0;
-		}
-		else if constexpr (sizeof(T) == 8)
-		{
-			unsigned long long bits = std::bit_cast<unsigned long long>(value);
-			return (bits & 0x8000000000000000) != 0;
-		}
-	}
+#if defined(__STDCPP_FLOAT32_T__)
+	template <>
+	constexpr inline std::float32_t negative_zero<std::float32_t> = std::bit_cast<std::float32_t>(0x80000000);
+#endif
 
-	template <std::integral T>
-	constexpr bool signbit(T value) noexcept
-	{
-		return signbit(static_cast<double>(value));
-	}
+#if defined(__STDCPP_FLOAT64_T__)
+	template <>
+	constexpr inline std::float64_t negative_zero<std::float64_t> = std::bit_cast<std::float64_t>(0x8000000000000000);
+#endif
 
+#if defined(CXCM_ENABLE_STATS)
 	//
-	// copysign()
+	// stats
 	//
 
-	// +0 or -0 for sign is considered as *not* negative
-	template <cxcm::concepts::basic_floating_point T>
-	constexpr T copysign(T value, T sgn) noexcept
+	// runtime counters for the constexpr algorithms. every thread has its own counters, which only it writes, so
+	// counting is a relaxed load and store with no contention. a mutex is only taken when a thread starts or ends
+	// counting, and by snapshot() and reset(). the counts of finished threads are kept.
+	namespace stats
 	{
-		// +0 or -0 for sign is considered as *not* negative
-		bool is_neg = signbit(sgn);
+		// converging_sqrt() steps are counted up to this many, and the last bucket has the rest
+		inline constexpr std::size_t sqrt_step_buckets = 16;
 
-		if constexpr (sizeof(T) == 4)
-		{
-			unsigned int bits = std::bit_cast<unsigned int>(value);
-			if (is_neg)
-				bits |= 0x80000000;
-			else
-				bits &= 0x7FFFFFFF;
+#if defined(CXCM_ENABLE_PATH_STATS)
+		// how many function, type, and path combinations can be told apart. the rest are counted together.
+		inline constexpr std::size_t max_path_sites = 256;
+#endif
 
-			return std::bit_cast<T>(bits);
-		}
-		else if constexpr (sizeof(T) == 8)
+		struct counts
 		{
-			unsigned long long bits = std::bit_cast<unsigned long long>(value);
-			if (is_neg)
-				bits |= 0x8000000000000000;
-			else
-				bits &= 0x7FFFFFFFFFFFFFFF;
-
-			return std::bit_cast<T>(bits);
-		}
-	}
-
-	template <std::integral T>
-	constexpr double copysign(T value, T sgn) noexcept
-	{
-		return copysign(static_cast<double>(value), static_cast<double>(sgn));
-	}
+			// screened out input
+			std::uint64_t nan{};
+			std::uint64_t infinity{};
+			std::uint64_t zero{};
+			std::uint64_t out_of_range{};
+
+			// how many calls to converging_sqrt() took each number of newton steps
+			std::array<std::uint64_t, sqrt_step_buckets> float_sqrt_steps{};
+			std::array<std::uint64_t, sqrt_step_buckets> double_sqrt_steps{};
+		};
 
-	// try and match standard library requirements.
-	// this namespace is pulled into parent namespace via inline.
-	inline namespace strict
-	{
 		namespace detail
 		{
-			//
-			// make_nan_quiet()
-			//
-
-			// make a NaN into a quiet NaN - if input is not a NaN, it is returned unchanged
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T convert_to_quiet_nan(T value) noexcept
+			enum counter : std::size_t
 			{
-				if (cxcm::isnan(value))
-				{
-					if constexpr (sizeof(T) == 4)
-					{
-						unsigned int bits = std::bit_cast<unsigned int>(value);
+				nan,
+				infinity,
+				zero,
+				out_of_range,
+				float_sqrt_steps,
+				double_sqrt_steps = float_sqrt_steps + sqrt_step_buckets,
+#if defined(CXCM_ENABLE_PATH_STATS)
+				path_sites = double_sqrt_steps + sqrt_step_buckets,
+				counter_count = path_sites + max_path_sites
+#else
+				counter_count = double_sqrt_steps + sqrt_step_buckets
+#endif
+			};
 
-						// set the is_quiet bit
-						bits |= 0x00400000;
+			using totals = std::array<std::uint64_t, counter_count>;
 
-						return std::bit_cast<T>(bits);
-					}
-					else if constexpr (sizeof(T) == 8)
-					{
-						unsigned long long bits = std::bit_cast<unsigned long long>(value);
+			struct thread_counters
+			{
+				std::array<std::atomic<std::uint64_t>, counter_count> values{};
 
-						// set the is_quiet bit
-						bits |= 0x0008000000000000;
+				thread_counters();
+				~thread_counters();
+			};
 
-						return std::bit_cast<T>(bits);
-					}
-				}
+			struct stats_state
+			{
+				std::mutex mutex;
+				std::vector<const thread_counters *> threads;
+				totals finished{};
+				totals baseline{};
+#if defined(CXCM_ENABLE_PATH_STATS)
+				// function<type> and path for each path site
+				std::vector<std::pair<std::string, std::string_view>> sites;
+#endif
+			};
 
-				return value;
+			inline stats_state &state() noexcept
+			{
+				static stats_state state;
+				return state;
 			}
 
-			//
-			// isnormal_or_subnormal()
-			//
+			inline thread_counters::thread_counters()
+			{
+				stats_state &all = state();
+				const std::lock_guard lock(all.mutex);
+				all.threads.push_back(this);
+			}
 
-			// standard library screening requirement for these functions
+			inline thread_counters::~thread_counters()
+			{
+				stats_state &all = state();
+				const std::lock_guard lock(all.mutex);
+				for (std::size_t i = 0; i < counter_count; ++i)
+					all.finished[i] += values[i].load(std::memory_order_relaxed);
+				std::erase(all.threads, this);
+			}
 
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr bool isnormal_or_subnormal(T value) noexcept
+			inline thread_counters *this_thread_counters() noexcept
 			{
-				// intentional use of the implicit cast of 0 to T.
-				return isfinite(value) && (value != 0);
+				thread_local thread_counters counters;
+				return &counters;
 			}
 
-			//
-			// fails_fractional_input_constraints()
-			//
+			// a plain pointer, so the hot path doesn't go through the thread_local initialization check
+			inline thread_local thread_counters *local_counters = nullptr;
 
-			// the fractional functions,e.g., trunc(), floor(), ceil(), round(), need the input to satisfy
-			// certain constraints before it further processes the input. if this function returns true,
-			// the constraints weren't met, and the fractional functions will do no further work and return
-			// the value as is.
+			inline void count(counter which, std::uint64_t amount = 1) noexcept
+			{
+				if (local_counters == nullptr) [[unlikely]]
+					local_counters = this_thread_counters();
 
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr bool fails_fractional_input_constraints(T value) noexcept
+				// only this thread writes, so there is no need for an atomic increment
+				auto &value = local_counters->values[which];
+				value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+			}
+
+			template <typename T>
+			void count_sqrt_steps(std::size_t steps) noexcept
 			{
-				// if any of the following constraints are not met, return true:
-				// no NaNs
-				// no +/- infinity
-				// no +/- 0
-				// no value that can't even have a fractional part
-				return !isnormal_or_subnormal(value) || (relaxed::abs(value) > limits::largest_fractional_value<T>);
+				const auto first = std::is_same_v<T, float> ? float_sqrt_steps : double_sqrt_steps;
+				count(static_cast<counter>(first + std::min(steps, sqrt_step_buckets - 1)));
 			}
 
-			//
-			// constexpr_trunc()
-			//
+#if defined(CXCM_ENABLE_PATH_STATS)
+			// a string literal as a template argument, so that each counting site gets its own static
+			template <std::size_t N>
+			struct site_name
+			{
+				char chars[N]{};
 
-			// rounds towards zero
+				constexpr site_name(const char (&name)[N]) noexcept
+				{
+					std::copy_n(name, N, chars);
+				}
 
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T constexpr_trunc(T value) noexcept
+				constexpr std::string_view view() const noexcept
+				{
+					return std::string_view(chars, N - 1);
+				}
+			};
+
+			template <typename T>
+			constexpr std::string_view type_name() noexcept
 			{
-#if !defined(__GNUC__) || defined(__clang__)
-				if (isnan(value))
-					return convert_to_quiet_nan(value);
-#endif
+				if constexpr (std::is_same_v<T, float>)
+					return "float";
+				else if constexpr (std::is_same_v<T, double>)
+					return "double";
+				else
+					return "long double";
+			}
 
-				// screen out unnecessary input
-				if (fails_fractional_input_constraints(value))
-					return value;
+			// the same function and path always get the same site, wherever they are counted from
+			inline std::size_t path_site(std::string function, std::string_view path)
+			{
+				stats_state &all = state();
+				const std::lock_guard lock(all.mutex);
 
-				return relaxed::trunc(value);
+				for (std::size_t i = 0; i < all.sites.size(); ++i)
+				{
+					if ((all.sites[i].first == function) && (all.sites[i].second == path))
+						return i;
+				}
+
+				if (all.sites.size() + 1 == max_path_sites)
+					return max_path_sites - 1;
+
+				all.sites.emplace_back(std::move(function), path);
+				return all.sites.size() - 1;
 			}
 
-			//
-			// constexpr_floor()
-			//
+			inline void count_path_site(std::size_t site, std::uint64_t values) noexcept
+			{
+				count(static_cast<counter>(path_sites + site), values);
+			}
 
-			// rounds towards negative infinity
+			// set while a batch function runs, so its scalar tails aren't counted again as std:: or cxcm calls
+			inline thread_local bool in_batch = false;
 
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T constexpr_floor(T value) noexcept
+			template <site_name Function, typename T, site_name Path>
+			void count_path() noexcept
 			{
-#if !defined(__GNUC__) || defined(__clang__)
-				if (isnan(value))
-					return convert_to_quiet_nan(value);
+				if (in_batch)
+					return;
+
+				static const std::size_t site = path_site(std::string(Function.view()) + "<" + std::string(type_name<T>()) + ">", Path.view());
+				count_path_site(site, 1);
+			}
 #endif
 
-				// screen out unnecessary input
-				if (fails_fractional_input_constraints(value))
-					return value;
+			// needs the mutex
+			inline totals current_totals(const stats_state &all) noexcept
+			{
+				totals result = all.finished;
+				for (const thread_counters *counters : all.threads)
+				{
+					for (std::size_t i = 0; i < counter_count; ++i)
+						result[i] += counters->values[i].load(std::memory_order_relaxed);
+				}
 
-				return relaxed::floor(value);
+				return result;
 			}
+		}
 
-			//
-			// constexpr_ceil()
-			//
+		// the counts from all threads since the start, or since the last reset()
+		inline counts snapshot()
+		{
+			detail::stats_state &all = detail::state();
+			const std::lock_guard lock(all.mutex);
+			const detail::totals current = detail::current_totals(all);
+
+			auto since_reset = [&](std::size_t i) { return current[i] - all.baseline[i]; };
+
+			counts result;
+			result.nan = since_reset(detail::nan);
+			result.infinity = since_reset(detail::infinity);
+			result.zero = since_reset(detail::zero);
+			result.out_of_range = since_reset(detail::out_of_range);
+			for (std::size_t i = 0; i < sqrt_step_buckets; ++i)
+			{
+				result.float_sqrt_steps[i] = since_reset(detail::float_sqrt_steps + i);
+				result.double_sqrt_steps[i] = since_reset(detail::double_sqrt_steps + i);
+			}
 
-			// rounds towards positive infinity
+			return result;
+		}
 
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T constexpr_ceil(T value) noexcept
-			{
-#if !defined(__GNUC__) || defined(__clang__)
-				if (isnan(value))
-					return convert_to_quiet_nan(value);
-#endif
+		// later snapshots only count from here. the threads' counters aren't touched, so nothing can be lost to a
+		// thread that is counting at the same time.
+		inline void reset()
+		{
+			detail::stats_state &all = detail::state();
+			const std::lock_guard lock(all.mutex);
+			all.baseline = detail::current_totals(all);
+		}
 
-				// screen out unnecessary input
-				if (fails_fractional_input_constraints(value))
-					return value;
+#if defined(CXCM_ENABLE_PATH_STATS)
+		// how many values went through one path of one function since the start or the last reset(). the paths are
+		// "std" for the standard library, "cxcm" for the cxcm algorithms, and "batch " and the tier the kernels were
+		// allowed to use for the tuned batch functions.
+		struct path_count
+		{
+			std::string function;
+			std::string_view path;
+			std::uint64_t values;
+		};
 
-				return relaxed::ceil(value);
+		// the paths that ran, the busiest first
+		inline std::vector<path_count> path_counts()
+		{
+			detail::stats_state &all = detail::state();
+			const std::lock_guard lock(all.mutex);
+			const detail::totals current = detail::current_totals(all);
+
+			std::vector<path_count> result;
+			for (std::size_t site = 0; site < max_path_sites; ++site)
+			{
+				const std::uint64_t values = current[detail::path_sites + site] - all.baseline[detail::path_sites + site];
+				if (values == 0)
+					continue;
+
+				if (site < all.sites.size())
+					result.push_back({all.sites[site].first, all.sites[site].second, values});
+				else
+					result.push_back({"(other)", "", values});
 			}
 
-			//
-			// constexpr_round()
-			//
+			std::stable_sort(result.begin(), result.end(), [](const path_count &a, const path_count &b) { return a.values > b.values; });
+			return result;
+		}
 
-			// rounds to nearest integral position, halfway cases away from zero
+		// path_counts() as a table. runtime calls that take the cxcm algorithms one value at a time are marked
+		// with the batch function that does the same work in vector registers.
+		inline std::string path_report()
+		{
+			std::string report = "function                       path              values\n";
 
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T constexpr_round(T value) noexcept
+			for (const auto &[function, path, values] : path_counts())
 			{
-#if !defined(__GNUC__) || defined(__clang__)
-				if (isnan(value))
-					return convert_to_quiet_nan(value);
+				std::string line = function;
+				line.resize(std::max<std::size_t>(line.size() + 1, 31), ' ');
+				line += path;
+				line.resize(std::max<std::size_t>(line.size() + 1, 49), ' ');
+				line += std::to_string(values);
+
+				if (path == "cxcm")
+				{
+					const std::string_view name = std::string_view(function).substr(0, function.find('<'));
+					if (name == "fast_rsqrt")
+						line += "  try batch::approx<Bits>::rsqrt";
+					else if ((name == "fract") || (name == "round_even") || (name == "rsqrt"))
+						line += "  try batch::" + std::string(name);
+				}
+
+				report += line + "\n";
+			}
+
+			return report;
+		}
 #endif
 
-				// screen out unnecessary input
-				if (fails_fractional_input_constraints(value))
-					return value;
+	} // namespace stats
 
-				// halfway rounding can bump into max long long value for truncation
-				// (for extended precision), so be more gentle at the end points.
-				// this works because the largest_fractional_value remainder is T(0.5f).
-				if (value == limits::largest_fractional_value<T>)
-					return value + T(0.5f);
-				else if (value == -limits::largest_fractional_value<T>)			// we technically don't have to do this for negative case (one more number in negative range)
-					return value - T(0.5f);
+#endif
 
-				return relaxed::round(value);
+	// don't worry about esoteric input.
+	// much faster than strict or standard when non constant evaluated,
+	// though standard library is a little better in debugger.
+	namespace relaxed
+	{
+		//
+		// abs(), fabs()
+		//
+
+		// absolute value
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T abs(T value) noexcept
+		{
+			return (value < T(0)) ? -value : value;
+		}
+
+		// undefined behavior if value is std::numeric_limits<T>::min()
+		template <std::signed_integral T>
+		constexpr T abs(T value) noexcept
+		{
+			return (value < T(0)) ? -value : value;
+		}
+
+		template <std::unsigned_integral T>
+		constexpr T abs(T value) noexcept
+		{
+			return value;
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T fabs(T value) noexcept
+		{
+			return abs(value);
+		}
+
+		template <std::integral T>
+		constexpr double fabs(T value) noexcept
+		{
+			return abs(value);
+		}
+
+		//
+		// trunc()
+		//
+
+		// this is the workhorse function for floor(), ceil(), and round().
+
+		// rounds towards zero
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T trunc(T value) noexcept
+		{
+			return static_cast<T>(static_cast<long long>(value));
+		}
+
+		// float specialization
+		template <>
+		constexpr float trunc(float value) noexcept
+		{
+			return static_cast<float>(static_cast<int>(value));
+		}
+
+		//
+		// floor()
+		//
+
+		// rounds towards negative infinity
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T floor(T value) noexcept
+		{
+			const T truncated_value = trunc(value);
+
+			// truncation rounds to zero which is right direction for positive values,
+			// but we need to go the other way for negative values.
+
+			// negative non-integral value
+			if (truncated_value > value)
+				return (truncated_value - T(1.0f));
+
+			// positive or integral value
+			return truncated_value;
+		}
+
+		//
+		// ceil()
+		//
+
+		// rounds towards positive infinity
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T ceil(T value) noexcept
+		{
+			const T truncated_value = trunc(value);
+
+			// truncation rounds to zero which is right direction for negative values,
+			// but we need to go the other way for positive values.
+
+			// positive non-integral value
+			if (truncated_value < value)
+				return (truncated_value + T(1.0f));
+
+			// negative or integral value
+			return truncated_value;
+		}
+
+		//
+		// round()
+		//
+
+		// rounds to nearest integral position, halfway cases away from zero
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T round(T value) noexcept
+		{
+			// what truncation cut off is exact, where value + 0.5 could round up to the next integer
+			const T truncated_value = trunc(value);
+			const T remainder = value - truncated_value;
+
+			if (remainder >= T(0.5f))
+				return truncated_value + T(1.0f);
+
+			if (remainder <= T(-0.5f))
+				return truncated_value - T(1.0f);
+
+			return truncated_value;
+		}
+
+		//
+		// fract() - not in standard library
+		//
+
+		// the fractional part of a floating point number - always non-negative.
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T fract(T value) noexcept
+		{
+			return value - floor(value);
+		}
+
+		//
+		// fmod()
+		//
+
+		// the floating point remainder of division
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T fmod(T x, T y) noexcept
+		{
+			return x - trunc(x / y) * y;
+		}
+
+		//
+		// round_even() - not in standard library
+		//
+
+		// rounds to nearest integral position, halfway cases towards even
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T round_even(T value) noexcept
+		{
+			// as in round(), except halfway cases only move away from an even truncated value
+			const T trunc_value = trunc(value);
+			const T remainder = value - trunc_value;
+			const bool is_odd = (fmod(trunc_value, T(2)) != T(0));
+
+			if ((remainder > T(0.5f)) || (is_odd && (remainder == T(0.5f))))
+				return trunc_value + T(1.0f);
+
+			if ((remainder < T(-0.5f)) || (is_odd && (remainder == T(-0.5f))))
+				return trunc_value - T(1.0f);
+
+			return trunc_value;
+		}
+
+		//
+		// sqrt()
+		//
+
+		namespace detail
+		{
+			// "Improving the Accuracy of the Fast Inverse Square Root by Modifying Newton-Raphson Corrections" 2021
+			// https://www.mdpi.com/1099-4300/23/1/86
+			//
+			// in comparison to inverse_sqrt(double), this method gives pretty good results:
+			//    0 ulps: ~68.58%
+			//    1 ulps: ~31.00%
+			//    2 ulps:  ~0.42%
+			//
+			// depending on compiler/platform, this may not be faster than rsqrt()
+			constexpr double fast_rsqrt(double x) noexcept
+			{
+				double halfx = 0.5 * x;
+				long long i = std::bit_cast<long long>(x);
+				i = 0x5FE6ED2102DCBFDA - (i >> 1);
+				double y = std::bit_cast<double>(i);
+				y *= 1.50087895511633457 - halfx * y * y;
+				y *= 1.50000057967625766 - halfx * y * y;
+				y *= 1.5000000000002520 - halfx * y * y;
+				y *= 1.5000000000000000 - halfx * y * y;
+				return y;
+			}
+
+			// the dd_real steps leave the root within an ulp, but they can't tell which way to round when the exact root
+			// is closer to halfway than their ~2^-106 error, e.g., just below powers of 4. with arg = X * 2^p and
+			// root = R * 2^q for 53-bit integers X and R, the exact root is above R + 1/2 when N = X * 2^(p - 2q) > R^2 + R,
+			// and below R - 1/2 when N <= R^2 - R. N and R^2 fit in 128 bits. arg and root are positive and normal.
+			constexpr double correctly_rounded_root(double arg, double root) noexcept
+			{
+				constexpr std::uint64_t fraction_mask = (std::uint64_t(1) << 52) - 1;
+
+				const std::uint64_t arg_bits = std::bit_cast<std::uint64_t>(arg);
+				const std::uint64_t root_bits = std::bit_cast<std::uint64_t>(root);
+				const std::uint64_t arg_significand = (arg_bits & fraction_mask) | (fraction_mask + 1);
+				const std::uint64_t root_significand = (root_bits & fraction_mask) | (fraction_mask + 1);
+				const int shift = static_cast<int>(arg_bits >> 52) - 2 * static_cast<int>(root_bits >> 52) + 1075;
+
+				// the root is within an ulp, so the shift is 51 to 54
+				if ((shift < 51) || (shift > 54))
+					return root;
+
+				// high and low 64 bits
+				struct wide
+				{
+					std::uint64_t high;
+					std::uint64_t low;
+
+					constexpr bool operator >(const wide &other) const noexcept
+					{
+						return (high > other.high) || ((high == other.high) && (low > other.low));
+					}
+				};
+
+				const wide n{arg_significand >> (64 - shift), arg_significand << shift};
+
+				// root_significand^2 from 32-bit halves
+				const std::uint64_t upper = root_significand >> 32;
+				const std::uint64_t lower = root_significand & 0xFFFFFFFF;
+				const std::uint64_t middle = 2 * upper * lower;
+				wide square{upper * upper + (middle >> 32), lower * lower};
+				square.high += ((square.low + (middle << 32)) < square.low) ? 1 : 0;
+				square.low += middle << 32;
+
+				auto plus = [](wide value, std::uint64_t amount) { return wide{value.high + (((value.low + amount) < value.low) ? 1 : 0), value.low + amount}; };
+				auto minus = [](wide value, std::uint64_t amount) { return wide{value.high - ((value.low < amount) ? 1 : 0), value.low - amount}; };
+
+				if (n > plus(square, root_significand))
+					return std::bit_cast<double>(root_bits + 1);
+
+				// at a power of two the next root down is only half an ulp away, so halfway is R - 1/4 and the bound
+				// is R^2 - R/2
+				const std::uint64_t below = (root_significand == fraction_mask + 1) ? root_significand / 2 : root_significand;
+				if (!(n > minus(square, below)))
+					return std::bit_cast<double>(root_bits - 1);
+
+				return root;
+			}
+
+			// float uses double internally, double uses dd_real internally
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T converging_sqrt(T arg) noexcept
+			{
+				const double boosted_arg = arg;
+				double init_value = boosted_arg * fast_rsqrt(boosted_arg);
+
+				if constexpr (std::is_same_v<T, double>)
+				{
+					// far from 1 the low parts of the dd_real steps lose bits, and near the smallest normals they can
+					// cycle forever, so those args are scaled by an even power of two first, which is exact both ways
+					if ((boosted_arg > 0) && (boosted_arg < 0x1.0p-900))
+						return converging_sqrt(boosted_arg * 0x1.0p+1000) * 0x1.0p-500;
+					else if ((boosted_arg > 0x1.0p+900) && (boosted_arg < std::numeric_limits<double>::infinity()))
+						return converging_sqrt(boosted_arg * 0x1.0p-1000) * 0x1.0p+500;
+
+					// boosted_arg doesn't need to be a dd_real for [T = double]
+
+					auto current_value = dd_real::dd_real(init_value);
+					auto previous_value = dd_real::dd_real(0.0);
+					[[maybe_unused]] std::size_t steps = 0;
+
+					while ((current_value[0] != previous_value[0]) && (current_value[0] * current_value[0] != boosted_arg))
+					{
+						previous_value = current_value;
+						current_value = 0.5 * (current_value + (boosted_arg / current_value));
+						++steps;
+					}
+
+					CXCM_STATS_SQRT_STEPS(double, steps);
+					return correctly_rounded_root(boosted_arg, static_cast<double>(current_value));
+				}
+				else if constexpr (std::is_same_v<T, float>)
+				{
+					double current_value = init_value;
+					double previous_value = 0.0;
+					[[maybe_unused]] std::size_t steps = 0;
+
+					while ((current_value != previous_value) && (current_value * current_value != boosted_arg))
+					{
+						previous_value = current_value;
+						current_value = 0.5 * (current_value + (boosted_arg / current_value));
+						++steps;
+					}
+
+					CXCM_STATS_SQRT_STEPS(float, steps);
+					return static_cast<float>(current_value);
+				}
+			}
+
+			// float uses double internally, double uses dd_real internally
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T inverse_sqrt(T arg) noexcept
+			{
+				// don't need this to be a dd_real
+				const double boosted_arg = arg;
+
+				if constexpr (std::is_same_v<T, double>)
+				{
+					// the estimate of 1 / sqrt(arg) gets squared, which overflows or underflows far from 1, so those
+					// args are scaled by an even power of two first, which is exact both ways
+					double scaled_arg = boosted_arg;
+					double scale = 1.0;
+					if ((boosted_arg > 0) && (boosted_arg < 0x1.0p-900))
+					{
+						scaled_arg = boosted_arg * 0x1.0p+1000;
+						scale = 0x1.0p+500;
+					}
+					else if ((boosted_arg > 0x1.0p+900) && (boosted_arg < std::numeric_limits<double>::infinity()))
+					{
+						scaled_arg = boosted_arg * 0x1.0p-1000;
+						scale = 0x1.0p-500;
+					}
+
+					auto current_value = dd_real::dd_real(fast_rsqrt(scaled_arg));
+
+					// one step leaves around 2^-103 relative error, which misrounds a few args near powers of 4, so
+					// there is a second one
+					current_value *= (1.5 - ((0.5 * scaled_arg) * (current_value * current_value)));
+					current_value *= (1.5 - ((0.5 * scaled_arg) * (current_value * current_value)));
+
+					return static_cast<double>(current_value) * scale;
+				}
+				else if constexpr (std::is_same_v<T, float>)
+				{
+					double current_value = fast_rsqrt(boosted_arg);
+
+					current_value *= (1.5 - (0.5 * boosted_arg * current_value * current_value));
+
+					// do a couple more refinements for floating point (this needs testing to see if necessary)
+					current_value *= (1.5 - (0.5 * boosted_arg * current_value * current_value));
+					current_value *= (1.5 - (0.5 * boosted_arg * current_value * current_value));
+
+					return static_cast<float>(current_value);
+				}
+			}
+
+			// long double uses an exact integer square root of the significand, so it is correctly rounded
+			template <std::same_as<long double> T>
+			constexpr T extended_sqrt(T arg) noexcept
+			{
+				if constexpr (bitwise::is_x87_long_double)
+				{
+					// arg is positive and finite
+					const auto bits = bitwise::to_x87_bits(arg);
+
+					// arg == significand * 2^power, with the integer bit of the significand set. subnormals have
+					// the same scale as the smallest exponent.
+					std::uint64_t significand = bits.significand;
+					int biased_exponent = bits.sign_exponent & bitwise::x87_exponent_mask;
+					if (biased_exponent == 0)
+						biased_exponent = 1;
+
+					const int leading_zeros = std::countl_zero(significand);
+					significand <<= leading_zeros;
+					const int power = biased_exponent - leading_zeros - bitwise::x87_exponent_bias - 63;
+
+					// shift the significand into the top of a 128-bit radicand, by an amount that keeps the power of two even.
+					// the radicand is in [2^126, 2^128), so the root is in [2^63, 2^64) -- exactly 64 significant bits.
+					const int shift = (power & 1) ? 63 : 64;
+					const auto [root, remainder] = bitwise::sqrt_with_remainder(bitwise::uint128{0, significand} << shift);
+					int root_power = (power - shift) / 2;
+
+					// sqrt(radicand) > root + 1/2 exactly when remainder > root, and it can never be a tie
+					std::uint64_t rounded_root = root;
+					if (bitwise::uint128{0, root} < remainder)
+					{
+						++rounded_root;
+						if (rounded_root == 0)
+						{
+							rounded_root = bitwise::x87_integer_bit;
+							++root_power;
+						}
+					}
+
+					return bitwise::from_x87_bits(rounded_root, static_cast<std::uint16_t>(root_power + 63 + bitwise::x87_exponent_bias));
+				}
+				else
+				{
+					return static_cast<long double>(converging_sqrt(static_cast<double>(arg)));
+				}
+			}
+
+		}	// namespace detail
+
+		// constexpr square root, uses higher precision behind the scenes
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T sqrt(T value) noexcept
+		{
+			// both long double versions are correctly rounded, so the hardware gives identical results much faster at runtime
+			if constexpr (std::is_same_v<T, long double>)
+				return std::is_constant_evaluated() ? detail::extended_sqrt(value) : std::sqrt(value);
+			else
+				return detail::converging_sqrt(value);
+		}
+
+		// reciprocal of square root, uses higher precision behind the scenes
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T rsqrt(T value) noexcept
+		{
+			// long double divides by the correctly rounded square root, within an ulp
+			if constexpr (std::is_same_v<T, long double>)
+				return 1.0L / (std::is_constant_evaluated() ? detail::extended_sqrt(value) : std::sqrt(value));
+			else
+				return detail::inverse_sqrt(value);
+		}
+
+		// fast reciprocal of square root
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T fast_rsqrt(T value) noexcept
+		{
+			// long double has a much wider range than the double approximation
+			if constexpr (std::is_same_v<T, long double>)
+				return rsqrt(value);
+			else
+				return static_cast<T>(detail::fast_rsqrt(static_cast<double>(value)));
+		}
+
+		//
+		// C++23 extended floating-point versions
+		//
+
+		// forwarded to the float or double versions, the conversions are free
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T abs(T value) noexcept
+		{
+			return static_cast<T>(relaxed::abs(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T fabs(T value) noexcept
+		{
+			return static_cast<T>(relaxed::fabs(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T trunc(T value) noexcept
+		{
+			return static_cast<T>(relaxed::trunc(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T floor(T value) noexcept
+		{
+			return static_cast<T>(relaxed::floor(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T ceil(T value) noexcept
+		{
+			return static_cast<T>(relaxed::ceil(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T round(T value) noexcept
+		{
+			return static_cast<T>(relaxed::round(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T fract(T value) noexcept
+		{
+			return static_cast<T>(relaxed::fract(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T fmod(T x, T y) noexcept
+		{
+			return static_cast<T>(relaxed::fmod(static_cast<standard_floating_point_t<T>>(x), static_cast<standard_floating_point_t<T>>(y)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T round_even(T value) noexcept
+		{
+			return static_cast<T>(relaxed::round_even(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T sqrt(T value) noexcept
+		{
+			return static_cast<T>(relaxed::sqrt(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T rsqrt(T value) noexcept
+		{
+			return static_cast<T>(relaxed::rsqrt(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T fast_rsqrt(T value) noexcept
+		{
+			return static_cast<T>(relaxed::fast_rsqrt(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+	} // namespace relaxed
+
+	//
+	// isnan()
+	//
+
+	// make sure this isn't optimized away if used with fast-math
+
+#if defined(_MSC_VER) || defined(__clang__) || defined(__INTEL_LLVM_COMPILER)
+#pragma float_control(precise, on, push)
+#endif
+
+	template <cxcm::concepts::basic_floating_point T>
+#if defined(__GNUC__) && !defined(__clang__)
+	__attribute__((optimize("-fno-fast-math")))
+#endif
+	constexpr bool isnan(T value) noexcept
+	{
+		return (value != value);
+	}
+
+#if defined(_MSC_VER) || defined(__clang__) || defined(__INTEL_LLVM_COMPILER)
+#pragma float_control(pop)
+#endif
+
+	template <std::integral T>
+	constexpr bool isnan(T value) noexcept
+	{
+		return isnan(static_cast<double>(value));
+	}
+
+	//
+	// isinf()
+	//
+
+	// make sure this isn't optimized away if used with fast-math
+
+#if defined(_MSC_VER) || defined(__clang__) || defined(__INTEL_LLVM_COMPILER)
+#pragma float_control(precise, on, push)
+#endif
+
+	template <cxcm::concepts::basic_floating_point T>
+#if defined(__GNUC__) && !defined(__clang__)
+	__attribute__((optimize("-fno-fast-math")))
+#endif
+	constexpr bool isinf(T value) noexcept
+	{
+		return (value == -std::numeric_limits<T>::infinity()) || (value == std::numeric_limits<T>::infinity());
+	}
+
+#if defined(_MSC_VER) || defined(__clang__) || defined(__INTEL_LLVM_COMPILER)
+#pragma float_control(pop)
+#endif
+
+	template <std::integral T>
+	constexpr bool isinf(T value) noexcept
+	{
+		return isinf(static_cast<double>(value));
+	}
+
+	//
+	// fpclassify()
+	//
+
+	template <cxcm::concepts::basic_floating_point T>
+	constexpr int fpclassify(T value) noexcept
+	{
+		if (isnan(value))
+			return FP_NAN;
+		else if (isinf(value))
+			return FP_INFINITE;
+		else if (value == 0)				// intentional use of the implicit cast of 0 to T.
+			return FP_ZERO;
+		else if (relaxed::abs(value) < std::numeric_limits<T>::min())
+			return FP_SUBNORMAL;
+
+		return FP_NORMAL;
+	}
+
+	template <std::integral T>
+	constexpr int fpclassify(T value) noexcept
+	{
+		return fpclassify(static_cast<double>(value));
+	}
+
+	//
+	// isnormal()
+	//
+
+	template <cxcm::concepts::basic_floating_point T>
+	constexpr bool isnormal(T value) noexcept
+	{
+		return (fpclassify(value) == FP_NORMAL);
+	}
+
+	template <std::integral T>
+	constexpr bool isnormal(T value) noexcept
+	{
+		return isnormal(static_cast<double>(value));
+	}
+
+	//
+	// isfinite()
+	//
+
+	template <cxcm::concepts::basic_floating_point T>
+	constexpr bool isfinite(T value) noexcept
+	{
+		return !isnan(value) && !isinf(value);
+	}
+
+	template <std::integral T>
+	constexpr bool isfinite(T value) noexcept
+	{
+		return isfinite(static_cast<double>(value));
+	}
+
+	//
+	// signbit()
+	//
+
+	// +0 returns false and -0 returns true
+	template <cxcm::concepts::basic_floating_point T>
+	constexpr bool signbit(T value) noexcept
+	{
+		if constexpr (sizeof(T) == 4)
+		{
+			unsigned int bits = std::bit_cast<unsigned int>(value);
+			return (bits & 0x80000000) != 0;
+		}
+		else if constexpr (sizeof(T) == 8)
+		{
+			unsigned long long bits = std::bit_cast<unsigned long long>(value);
+			return (bits & 0x8000000000000000) != 0;
+		}
+		else if constexpr (bitwise::is_x87_long_double)
+		{
+			return (bitwise::to_x87_bits(value).sign_exponent & bitwise::x87_sign_mask) != 0;
+		}
+	}
+
+	template <std::integral T>
+	constexpr bool signbit(T value) noexcept
+	{
+		return signbit(static_cast<double>(value));
+	}
+
+	// the long double specialization of is_negative_zero() needs signbit()
+	template<>
+	constexpr bool is_negative_zero(long double val) noexcept
+	{
+		return (val == 0.0L) && signbit(val);
+	}
+
+	//
+	// copysign()
+	//
+
+	// +0 or -0 for sign is considered as *not* negative
+	template <cxcm::concepts::basic_floating_point T>
+	constexpr T copysign(T value, T sgn) noexcept
+	{
+		// +0 or -0 for sign is considered as *not* negative
+		bool is_neg = signbit(sgn);
+
+		if constexpr (sizeof(T) == 4)
+		{
+			unsigned int bits = std::bit_cast<unsigned int>(value);
+			if (is_neg)
+				bits |= 0x80000000;
+			else
+				bits &= 0x7FFFFFFF;
+
+			return std::bit_cast<T>(bits);
+		}
+		else if constexpr (sizeof(T) == 8)
+		{
+			unsigned long long bits = std::bit_cast<unsigned long long>(value);
+			if (is_neg)
+				bits |= 0x8000000000000000;
+			else
+				bits &= 0x7FFFFFFFFFFFFFFF;
+
+			return std::bit_cast<T>(bits);
+		}
+		else if constexpr (bitwise::is_x87_long_double)
+		{
+			auto bits = bitwise::to_x87_bits(value);
+			if (is_neg)
+				bits.sign_exponent |= bitwise::x87_sign_mask;
+			else
+				bits.sign_exponent &= bitwise::x87_exponent_mask;
+
+			return bitwise::from_x87_bits(bits.significand, bits.sign_exponent);
+		}
+	}
+
+	template <std::integral T>
+	constexpr double copysign(T value, T sgn) noexcept
+	{
+		return copysign(static_cast<double>(value), static_cast<double>(sgn));
+	}
+
+	//
+	// classification of 16-bit floating-point types
+	//
+
+	// straight from the bits. going through float would report float16 subnormals as normal.
+
+	template <cxcm::concepts::half_floating_point T>
+	constexpr bool isnan(T value) noexcept
+	{
+		return (value.bits & ~T::sign_mask) > T::exponent_mask;
+	}
+
+	template <cxcm::concepts::half_floating_point T>
+	constexpr bool isinf(T value) noexcept
+	{
+		return (value.bits & ~T::sign_mask) == T::exponent_mask;
+	}
+
+	template <cxcm::concepts::half_floating_point T>
+	constexpr int fpclassify(T value) noexcept
+	{
+		const bool has_significand = (value.bits & T::significand_mask) != 0;
+
+		switch (value.bits & T::exponent_mask)
+		{
+			case T::exponent_mask:
+				return has_significand ? FP_NAN : FP_INFINITE;
+
+			case 0:
+				return has_significand ? FP_SUBNORMAL : FP_ZERO;
+
+			default:
+				return FP_NORMAL;
+		}
+	}
+
+	template <cxcm::concepts::half_floating_point T>
+	constexpr bool isnormal(T value) noexcept
+	{
+		return (fpclassify(value) == FP_NORMAL);
+	}
+
+	template <cxcm::concepts::half_floating_point T>
+	constexpr bool isfinite(T value) noexcept
+	{
+		return (value.bits & T::exponent_mask) != T::exponent_mask;
+	}
+
+	template <cxcm::concepts::half_floating_point T>
+	constexpr bool signbit(T value) noexcept
+	{
+		return (value.bits & T::sign_mask) != 0;
+	}
+
+	template <cxcm::concepts::half_floating_point T>
+	constexpr T copysign(T value, T sgn) noexcept
+	{
+		return T::from_bits(static_cast<std::uint16_t>((value.bits & ~T::sign_mask) | (sgn.bits & T::sign_mask)));
+	}
+
+	//
+	// classification of binary128
+	//
+
+	template <cxcm::concepts::quad_floating_point T>
+	constexpr int fpclassify(T value) noexcept
+	{
+		const auto bits = bitwise::to_quad_bits(value);
+		const bool has_significand = ((bits.high & bitwise::quad_significand_mask) != 0) || (bits.low != 0);
+
+		switch (bits.high & bitwise::quad_exponent_mask)
+		{
+			case bitwise::quad_exponent_mask:
+				return has_significand ? FP_NAN : FP_INFINITE;
+
+			case 0:
+				return has_significand ? FP_SUBNORMAL : FP_ZERO;
+
+			default:
+				return FP_NORMAL;
+		}
+	}
+
+	template <cxcm::concepts::quad_floating_point T>
+	constexpr bool isnan(T value) noexcept
+	{
+		return (fpclassify(value) == FP_NAN);
+	}
+
+	template <cxcm::concepts::quad_floating_point T>
+	constexpr bool isinf(T value) noexcept
+	{
+		return (fpclassify(value) == FP_INFINITE);
+	}
+
+	template <cxcm::concepts::quad_floating_point T>
+	constexpr bool isnormal(T value) noexcept
+	{
+		return (fpclassify(value) == FP_NORMAL);
+	}
+
+	template <cxcm::concepts::quad_floating_point T>
+	constexpr bool isfinite(T value) noexcept
+	{
+		return (bitwise::to_quad_bits(value).high & bitwise::quad_exponent_mask) != bitwise::quad_exponent_mask;
+	}
+
+	template <cxcm::concepts::quad_floating_point T>
+	constexpr bool signbit(T value) noexcept
+	{
+		return (bitwise::to_quad_bits(value).high & bitwise::quad_sign_mask) != 0;
+	}
+
+	template <cxcm::concepts::quad_floating_point T>
+	constexpr T copysign(T value, T sgn) noexcept
+	{
+		auto bits = bitwise::to_quad_bits(value);
+		bits.high = (bits.high & ~bitwise::quad_sign_mask) | (bitwise::to_quad_bits(sgn).high & bitwise::quad_sign_mask);
+
+		return bitwise::from_quad_bits<T>(bits);
+	}
+
+	//
+	// classification of C++23 extended floating-point types
+	//
+
+	// the standard versions when they are constexpr, otherwise the float or double versions
+
+	template <cxcm::concepts::extended_floating_point T>
+	constexpr bool isnan(T value) noexcept
+	{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+		return std::isnan(value);
+#else
+		return isnan(static_cast<standard_floating_point_t<T>>(value));
+#endif
+	}
+
+	template <cxcm::concepts::extended_floating_point T>
+	constexpr bool isinf(T value) noexcept
+	{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+		return std::isinf(value);
+#else
+		return isinf(static_cast<standard_floating_point_t<T>>(value));
+#endif
+	}
+
+	template <cxcm::concepts::extended_floating_point T>
+	constexpr int fpclassify(T value) noexcept
+	{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+		return std::fpclassify(value);
+#else
+		return fpclassify(static_cast<standard_floating_point_t<T>>(value));
+#endif
+	}
+
+	template <cxcm::concepts::extended_floating_point T>
+	constexpr bool isnormal(T value) noexcept
+	{
+		return (fpclassify(value) == FP_NORMAL);
+	}
+
+	template <cxcm::concepts::extended_floating_point T>
+	constexpr bool isfinite(T value) noexcept
+	{
+		return !isnan(value) && !isinf(value);
+	}
+
+	template <cxcm::concepts::extended_floating_point T>
+	constexpr bool signbit(T value) noexcept
+	{
+		return signbit(static_cast<standard_floating_point_t<T>>(value));
+	}
+
+	template <cxcm::concepts::extended_floating_point T>
+	constexpr T copysign(T value, T sgn) noexcept
+	{
+		return static_cast<T>(copysign(static_cast<standard_floating_point_t<T>>(value), static_cast<standard_floating_point_t<T>>(sgn)));
+	}
+
+	// try and match standard library requirements.
+	// this namespace is pulled into parent namespace via inline.
+	inline namespace strict
+	{
+		namespace detail
+		{
+			//
+			// make_nan_quiet()
+			//
+
+			// make a NaN into a quiet NaN - if input is not a NaN, it is returned unchanged
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T convert_to_quiet_nan(T value) noexcept
+			{
+				if (cxcm::isnan(value))
+				{
+					if constexpr (sizeof(T) == 4)
+					{
+						unsigned int bits = std::bit_cast<unsigned int>(value);
+
+						// set the is_quiet bit
+						bits |= 0x00400000;
+
+						return std::bit_cast<T>(bits);
+					}
+					else if constexpr (sizeof(T) == 8)
+					{
+						unsigned long long bits = std::bit_cast<unsigned long long>(value);
+
+						// set the is_quiet bit
+						bits |= 0x0008000000000000;
+
+						return std::bit_cast<T>(bits);
+					}
+					else if constexpr (bitwise::is_x87_long_double)
+					{
+						auto bits = bitwise::to_x87_bits(value);
+
+						// set the is_quiet bit, just below the explicit integer bit
+						bits.significand |= bitwise::x87_quiet_bit;
+
+						return bitwise::from_x87_bits(bits.significand, bits.sign_exponent);
+					}
+				}
+
+				return value;
+			}
+
+			//
+			// isnormal_or_subnormal()
+			//
+
+			// standard library screening requirement for these functions
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr bool isnormal_or_subnormal(T value) noexcept
+			{
+				// intentional use of the implicit cast of 0 to T.
+				return isfinite(value) && (value != 0);
+			}
+
+			//
+			// fails_fractional_input_constraints()
+			//
+
+			// the fractional functions,e.g., trunc(), floor(), ceil(), round(), need the input to satisfy
+			// certain constraints before it further processes the input. if this function returns true,
+			// the constraints weren't met, and the fractional functions will do no further work and return
+			// the value as is.
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr bool fails_fractional_input_constraints(T value) noexcept
+			{
+				// if any of the following constraints are not met, return true:
+				// no NaNs
+				// no +/- infinity
+				// no +/- 0
+				// no value that can't even have a fractional part
+#if defined(CXCM_ENABLE_STATS)
+				if (isnan(value))
+					CXCM_STATS_COUNT(nan);
+				else if (isinf(value))
+					CXCM_STATS_COUNT(infinity);
+				else if (value == 0)
+					CXCM_STATS_COUNT(zero);
+				else if (relaxed::abs(value) > limits::largest_fractional_value<T>)
+					CXCM_STATS_COUNT(out_of_range);
+#endif
+				return !isnormal_or_subnormal(value) || (relaxed::abs(value) > limits::largest_fractional_value<T>);
+			}
+
+			//
+			// constexpr_trunc()
+			//
+
+			// rounds towards zero
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_trunc(T value) noexcept
+			{
+#if !defined(__GNUC__) || defined(__clang__)
+				if (isnan(value))
+					return convert_to_quiet_nan(value);
+#endif
+
+				// screen out unnecessary input
+				if (fails_fractional_input_constraints(value))
+					return value;
+
+				return relaxed::trunc(value);
+			}
+
+			//
+			// constexpr_floor()
+			//
+
+			// rounds towards negative infinity
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_floor(T value) noexcept
+			{
+#if !defined(__GNUC__) || defined(__clang__)
+				if (isnan(value))
+					return convert_to_quiet_nan(value);
+#endif
+
+				// screen out unnecessary input
+				if (fails_fractional_input_constraints(value))
+					return value;
+
+				return relaxed::floor(value);
+			}
+
+			//
+			// constexpr_ceil()
+			//
+
+			// rounds towards positive infinity
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_ceil(T value) noexcept
+			{
+#if !defined(__GNUC__) || defined(__clang__)
+				if (isnan(value))
+					return convert_to_quiet_nan(value);
+#endif
+
+				// screen out unnecessary input
+				if (fails_fractional_input_constraints(value))
+					return value;
+
+				return relaxed::ceil(value);
+			}
+
+			//
+			// constexpr_round()
+			//
+
+			// rounds to nearest integral position, halfway cases away from zero
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_round(T value) noexcept
+			{
+#if !defined(__GNUC__) || defined(__clang__)
+				if (isnan(value))
+					return convert_to_quiet_nan(value);
+#endif
+
+				// screen out unnecessary input
+				if (fails_fractional_input_constraints(value))
+					return value;
+
+				// halfway rounding can bump into max long long value for truncation
+				// (for extended precision), so be more gentle at the end points.
+				// this works because the largest_fractional_value remainder is T(0.5f).
+				if (value == limits::largest_fractional_value<T>)
+					return value + T(0.5f);
+				else if (value == -limits::largest_fractional_value<T>)			// we technically don't have to do this for negative case (one more number in negative range)
+					return value - T(0.5f);
+
+				return relaxed::round(value);
+			}
+
+			//
+			// constexpr_fract()
+			//
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_fract(T value) noexcept
+			{
+#if !defined(__GNUC__) || defined(__clang__)
+				if (isnan(value))
+					return convert_to_quiet_nan(value);
+#endif
+
+				// screen out unnecessary input
+				if (fails_fractional_input_constraints(value))
+					return value;
+
+				return relaxed::fract(value);
+			}
+
+			//
+			// unpack(), pack() - finite floating-point values as integers
+			//
+
+			// value == significand * 2^exponent, with the top bit of the 64-bit significand set
+			struct unpacked_float
+			{
+				bool negative = false;
+				int exponent = 0;
+				std::uint64_t significand = 0;
+			};
+
+			// finite, non-zero values only. subnormals are normalized.
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr unpacked_float unpack(T value) noexcept
+			{
+				constexpr int digits = std::numeric_limits<T>::digits;
+				constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+
+				unpacked_float result;
+				std::uint64_t significand = 0;
+				int exponent = 0;
+
+				if constexpr (std::is_same_v<T, long double> && bitwise::is_x87_long_double)
+				{
+					// the integer bit is explicit
+					const auto bits = bitwise::to_x87_bits(value);
+					const int biased_exponent = bits.sign_exponent & bitwise::x87_exponent_mask;
+
+					result.negative = (bits.sign_exponent & bitwise::x87_sign_mask) != 0;
+					significand = bits.significand;
+					exponent = ((biased_exponent == 0) ? 1 : biased_exponent) - bias - 63;
+				}
+				else
+				{
+					using bits_type = std::conditional_t<(sizeof(T) == 4), std::uint32_t, std::uint64_t>;
+					constexpr int exponent_bits = static_cast<int>(sizeof(T) * 8) - digits;
+
+					const bits_type bits = std::bit_cast<bits_type>(value);
+					const int biased_exponent = static_cast<int>((bits >> (digits - 1)) & ((bits_type(1) << exponent_bits) - 1));
+
+					result.negative = (bits >> (sizeof(T) * 8 - 1)) != 0;
+					significand = bits & ((bits_type(1) << (digits - 1)) - 1);
+					if (biased_exponent != 0)
+						significand |= std::uint64_t(1) << (digits - 1);
+
+					exponent = ((biased_exponent == 0) ? 1 : biased_exponent) - bias - (digits - 1);
+				}
+
+				const int leading_zeros = std::countl_zero(significand);
+				result.significand = significand << leading_zeros;
+				result.exponent = exponent - leading_zeros;
+
+				return result;
+			}
+
+			// significand * 2^exponent, for a significand with its top bit set. rounded to nearest, ties to even,
+			// including underflow to subnormals or zero, and overflow to infinity.
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T pack(bool negative, int exponent, std::uint64_t significand) noexcept
+			{
+				constexpr int digits = std::numeric_limits<T>::digits;
+				constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+				constexpr int infinity_exponent = 2 * bias + 1;
+
+				// the biased exponent of the top bit, and how many bits don't fit
+				const int biased_exponent = exponent + 63 + bias;
+				const int shift = 64 - digits + ((biased_exponent < 1) ? (1 - biased_exponent) : 0);
+
+				std::uint64_t rounded = 0;
+				if (shift == 0)
+				{
+					rounded = significand;
+				}
+				else if (shift <= 64)
+				{
+					const std::uint64_t kept = (shift == 64) ? 0 : (significand >> shift);
+					const std::uint64_t rest = (shift == 64) ? significand : (significand & ((std::uint64_t(1) << shift) - 1));
+					const std::uint64_t halfway = std::uint64_t(1) << (shift - 1);
+
+					rounded = kept + (((rest > halfway) || ((rest == halfway) && (kept & 1))) ? 1 : 0);
+				}
+
+				if constexpr (std::is_same_v<T, long double> && bitwise::is_x87_long_double)
+				{
+					const std::uint16_t sign = negative ? bitwise::x87_sign_mask : 0;
+
+					if (biased_exponent >= infinity_exponent)
+						return bitwise::from_x87_bits(bitwise::x87_integer_bit, sign | bitwise::x87_exponent_mask);
+
+					// a subnormal that rounded up to the integer bit is the smallest normal
+					const int exponent_field = (biased_exponent >= 1) ? biased_exponent : ((rounded & bitwise::x87_integer_bit) ? 1 : 0);
+
+					return bitwise::from_x87_bits(rounded, static_cast<std::uint16_t>(sign | exponent_field));
+				}
+				else
+				{
+					using bits_type = std::conditional_t<(sizeof(T) == 4), std::uint32_t, std::uint64_t>;
+
+					const bits_type sign = negative ? (bits_type(1) << (sizeof(T) * 8 - 1)) : 0;
+
+					if (biased_exponent >= infinity_exponent)
+						return std::bit_cast<T>(static_cast<bits_type>(sign | (bits_type(infinity_exponent) << (digits - 1))));
+
+					// the leading bit of a normal significand adds one to the exponent field, and a carry out of
+					// rounding correctly bumps the exponent, all the way to infinity
+					if (biased_exponent >= 1)
+						return std::bit_cast<T>(static_cast<bits_type>(sign | ((static_cast<bits_type>(biased_exponent - 1) << (digits - 1)) + rounded)));
+
+					return std::bit_cast<T>(static_cast<bits_type>(sign | rounded));
+				}
+			}
+
+			//
+			// exact_remainder()
+			//
+
+			// x - n * y for the integer n = x / y rounded towards zero, or to nearest even, by long division of the
+			// integer significands, so it is exact for any ratio of x to y. the low bits of n go in quotient, with
+			// the sign of x / y, if it isn't null. finite x and finite non-zero y only.
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T exact_remainder(T x, T y, bool to_nearest, int *quotient) noexcept
+			{
+				constexpr int digits = std::numeric_limits<T>::digits;
+
+				if (x == T(0))
+				{
+					if (quotient != nullptr)
+						*quotient = 0;
+
+					return x;
+				}
+
+				const unpacked_float x_parts = unpack(x);
+				const unpacked_float y_parts = unpack(y);
+
+				// integral significands below 2^digits
+				const std::uint64_t x_significand = x_parts.significand >> (64 - digits);
+				const std::uint64_t y_significand = y_parts.significand >> (64 - digits);
+				const int x_exponent = x_parts.exponent + (64 - digits);
+				const int y_exponent = y_parts.exponent + (64 - digits);
+
+				bool negative = x_parts.negative;
+				std::uint64_t remainder = x_significand;
+				std::uint64_t low_quotient = 0;
+				int exponent = x_exponent;
+				int shift = x_exponent - y_exponent;
+
+				if (shift >= 0)
+				{
+					// the significands are within a factor of two, then bring down as many bits at a time as fit
+					low_quotient = remainder / y_significand;
+					remainder %= y_significand;
+
+					if constexpr (digits < 64)
+					{
+						constexpr int step_limit = 64 - digits;
+
+						while (shift > 0)
+						{
+							const int step = (shift < step_limit) ? shift : step_limit;
+
+							remainder <<= step;
+							low_quotient = (low_quotient << step) + remainder / y_significand;
+							remainder %= y_significand;
+							shift -= step;
+						}
+					}
+					else
+					{
+						// a bit at a time, the bit shifted out is part of the partial remainder
+						while (shift > 0)
+						{
+							const bool carry = (remainder >> 63) != 0;
+
+							remainder <<= 1;
+							low_quotient <<= 1;
+
+							if (carry || (remainder >= y_significand))
+							{
+								remainder -= y_significand;
+								low_quotient |= 1;
+							}
+
+							--shift;
+						}
+					}
+
+					exponent = y_exponent;
+
+					// more than half of y, or exactly half with an odd quotient, goes to the next multiple of y
+					if (to_nearest && ((remainder > y_significand - remainder) || ((remainder == y_significand - remainder) && (low_quotient & 1))))
+					{
+						remainder = y_significand - remainder;
+						negative = !negative;
+						++low_quotient;
+					}
+				}
+				else if (to_nearest && (shift == -1) && (x_significand > y_significand))
+				{
+					// more than half of y, with x at half the scale of y
+					remainder = y_significand - (x_significand - y_significand);
+					negative = !negative;
+					low_quotient = 1;
+				}
+
+				if (quotient != nullptr)
+				{
+					const int low_bits = static_cast<int>(low_quotient & 7);
+					*quotient = (x_parts.negative != y_parts.negative) ? -low_bits : low_bits;
+				}
+
+				// the result is exact, so it never rounds
+				if (remainder == 0)
+					return x_parts.negative ? -T(0) : T(0);
+
+				const int leading_zeros = std::countl_zero(remainder);
+
+				return pack<T>(negative, exponent - leading_zeros, remainder << leading_zeros);
+			}
+
+			//
+			// constexpr_fmod()
+			//
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_fmod(T x, T y) noexcept
+			{
+				// screen out unnecessary input
+
+				if (isnan(x) || isnan(y) || !isfinite(x))
+					return std::numeric_limits<T>::quiet_NaN();
+
+				if (isinf(y))
+					return x;
+
+				if (x == T(0) && y != T(0))
+					return x;
+
+				if (y == 0)
+					return std::numeric_limits<T>::quiet_NaN();
+
+				return exact_remainder(x, y, false, nullptr);
+			}
+
+			//
+			// constexpr_remainder(), constexpr_remquo()
+			//
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_remquo(T x, T y, int *quotient) noexcept
+			{
+				*quotient = 0;
+
+				if (isnan(x) || isnan(y) || !isfinite(x) || (y == 0))
+					return std::numeric_limits<T>::quiet_NaN();
+
+				if (isinf(y))
+					return x;
+
+				return exact_remainder(x, y, true, quotient);
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_remainder(T x, T y) noexcept
+			{
+				int quotient = 0;
+
+				return constexpr_remquo(x, y, &quotient);
+			}
+
+			//
+			// constexpr_round_even()
+			//
+
+			// rounds to nearest integral position, halfway cases away from zero
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_round_even(T value) noexcept
+			{
+#if !defined(__GNUC__) || defined(__clang__)
+				if (isnan(value))
+					return convert_to_quiet_nan(value);
+#endif
+
+				// screen out unnecessary input
+				if (fails_fractional_input_constraints(value))
+					return value;
+
+				// halfway rounding can bump into max long long value for truncation
+				// (for extended precision), so be more gentle at the end points.
+				// this works because the largest_fractional_value remainder is T(0.5f).
+				if (value == limits::largest_fractional_value<T>)
+					return value + T(0.5f);
+				else if (value == -limits::largest_fractional_value<T>)			// we technically don't have to do this for negative case (one more number in negative range)
+					return value - T(0.5f);
+
+				return relaxed::round_even(value);
+			}
+
+			//
+			// constexpr_sqrt()
+			//
+
+			//
+			// integer_sqrt()
+			//
+
+			// square root of a positive, finite float or double from an exact digit by digit square root of its
+			// significand, so it is correctly rounded with a fixed number of steps (25 for float, 54 for double).
+			// the root has one more bit than the result and the remainder is under twice the root, so everything
+			// fits in 64 bits. select it for constexpr_sqrt() by defining CXCM_INTEGER_SQRT.
+			template <cxcm::concepts::basic_floating_point T>
+			requires (std::numeric_limits<T>::digits <= 53)
+			constexpr T integer_sqrt(T value) noexcept
+			{
+				using bits_type = std::conditional_t<(sizeof(T) == 4), std::uint32_t, std::uint64_t>;
+				constexpr int digits = std::numeric_limits<T>::digits;
+				constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+				constexpr bits_type fraction_mask = (bits_type(1) << (digits - 1)) - 1;
+
+				// value == significand * 2^power, with the significand in [2^(digits - 1), 2^digits)
+				const bits_type bits = std::bit_cast<bits_type>(value);
+				std::uint64_t significand = bits & fraction_mask;
+				int biased_exponent = static_cast<int>(bits >> (digits - 1));
+				if (biased_exponent == 0)
+					biased_exponent = 1;
+				else
+					significand |= std::uint64_t(1) << (digits - 1);
+
+				const int leading_zeros = std::countl_zero(significand) - (64 - digits);
+				significand <<= leading_zeros;
+				int power = biased_exponent - leading_zeros - bias - (digits - 1);
+
+				// the radicand is significand * 2^(digits + 1), with an even power of two left over. its top digits + 1
+				// bits are the significand and the rest are zero.
+				if ((power - (digits + 1)) & 1)
+				{
+					significand <<= 1;
+					--power;
+				}
+
+				std::uint64_t radicand = significand << (63 - digits);
+				std::uint64_t root = 0;
+				std::uint64_t remainder = 0;
+				for (int i = 0; i <= digits; ++i)
+				{
+					remainder = (remainder << 2) | (radicand >> 62);
+					radicand <<= 2;
+
+					const std::uint64_t trial = (root << 2) | 1;
+					root <<= 1;
+					if (remainder >= trial)
+					{
+						remainder -= trial;
+						root |= 1;
+					}
+				}
+
+				// the root is in [2^digits, 2^(digits + 1)). round off the last bit to nearest even, with the
+				// remainder as the sticky bit.
+				std::uint64_t rounded = root >> 1;
+				if ((root & 1) && ((remainder != 0) || (rounded & 1)))
+					++rounded;
+
+				// adding the root, including its leading bit, to the exponent field one below its value carries
+				// correctly if rounding reached 2^digits
+				const int biased_result = (power - (digits + 1)) / 2 + 1 + bias + (digits - 1);
+				return std::bit_cast<T>(static_cast<bits_type>((static_cast<std::uint64_t>(biased_result - 1) << (digits - 1)) + rounded));
+			}
+
+			// make sure this isn't optimized away if used with fast-math
+
+#if defined(_MSC_VER) || defined(__clang__)
+#pragma float_control(precise, on, push)
+#endif
+
+			template <cxcm::concepts::basic_floating_point T>
+#if defined(__GNUC__) && !defined(__clang__)
+			__attribute__((optimize("-fno-fast-math")))
+#endif
+			constexpr T constexpr_sqrt(T value) noexcept
+			{
+				// screen out unnecessary input
+
+				if (isnan(value))
+				{
+					CXCM_STATS_COUNT(nan);
+					return detail::convert_to_quiet_nan(value);
+				}
+				else if (value == std::numeric_limits<T>::infinity())
+				{
+					CXCM_STATS_COUNT(infinity);
+					return value;
+				}
+				else if (value == -std::numeric_limits<T>::infinity())
+				{
+					CXCM_STATS_COUNT(infinity);
+					return -std::numeric_limits<T>::quiet_NaN();
+				}
+				else if (value == T(0))
+				{
+					CXCM_STATS_COUNT(zero);
+					return value;
+				}
+				else if (value < T(0))
+				{
+					CXCM_STATS_COUNT(out_of_range);
+					return -std::numeric_limits<T>::quiet_NaN();
+				}
+
+#if defined(CXCM_INTEGER_SQRT)
+				if constexpr (std::numeric_limits<T>::digits <= 53)
+					return integer_sqrt(value);
+				else
+					return relaxed::sqrt(value);
+#else
+				return relaxed::sqrt(value);
+#endif
+			}
+
+#if defined(_MSC_VER) || defined(__clang__)
+#pragma float_control(pop)
+#endif
+
+			//
+			// constexpr_inverse_sqrt()
+			//
+
+			// make sure this isn't optimized away if used with fast-math
+
+#if defined(_MSC_VER) || defined(__clang__)
+#pragma float_control(precise, on, push)
+#endif
+
+			template <cxcm::concepts::basic_floating_point T>
+#if defined(__GNUC__) && !defined(__clang__)
+			__attribute__((optimize("-fno-fast-math")))
+#endif
+			constexpr T constexpr_rsqrt(T value) noexcept
+			{
+				// screen out unnecessary input
+
+				if (isnan(value))
+				{
+					CXCM_STATS_COUNT(nan);
+					return detail::convert_to_quiet_nan(value);
+				}
+				else if (value == std::numeric_limits<T>::infinity())
+				{
+					CXCM_STATS_COUNT(infinity);
+					return T(0);
+				}
+				else if (value == -std::numeric_limits<T>::infinity())
+				{
+					CXCM_STATS_COUNT(infinity);
+					return -std::numeric_limits<T>::quiet_NaN();
+				}
+				else if (value == T(0))
+				{
+					CXCM_STATS_COUNT(zero);
+					return std::numeric_limits<T>::infinity();
+				}
+				else if (value < T(0))
+				{
+					CXCM_STATS_COUNT(out_of_range);
+					return -std::numeric_limits<T>::quiet_NaN();
+				}
+
+				return relaxed::rsqrt(value);
+			}
+
+#if defined(_MSC_VER) || defined(__clang__)
+#pragma float_control(pop)
+#endif
+
+			// make sure this isn't optimized away if used with fast-math
+
+#if defined(_MSC_VER) || defined(__clang__)
+#pragma float_control(precise, on, push)
+#endif
+
+			template <cxcm::concepts::basic_floating_point T>
+#if defined(__GNUC__) && !defined(__clang__)
+			__attribute__((optimize("-fno-fast-math")))
+#endif
+			constexpr T constexpr_fast_rsqrt(T value) noexcept
+			{
+				// screen out unnecessary input
+
+				if (isnan(value))
+				{
+					CXCM_STATS_COUNT(nan);
+					return detail::convert_to_quiet_nan(value);
+				}
+				else if (value == std::numeric_limits<T>::infinity())
+				{
+					CXCM_STATS_COUNT(infinity);
+					return T(0);
+				}
+				else if (value == -std::numeric_limits<T>::infinity())
+				{
+					CXCM_STATS_COUNT(infinity);
+					return -std::numeric_limits<T>::quiet_NaN();
+				}
+				else if (value == T(0))
+				{
+					CXCM_STATS_COUNT(zero);
+					return std::numeric_limits<T>::infinity();
+				}
+				else if (value < T(0))
+				{
+					CXCM_STATS_COUNT(out_of_range);
+					return -std::numeric_limits<T>::quiet_NaN();
+				}
+
+				return relaxed::fast_rsqrt(value);
+			}
+
+#if defined(_MSC_VER) || defined(__clang__)
+#pragma float_control(pop)
+#endif
+
+			//
+			// constant evaluation dispatch
+			//
+
+			// the fastest constant evaluation available: the standard library when it is constexpr, then gcc's
+			// builtins, then the cxcm algorithms. the builtins only get finite input with a finite result, since
+			// gcc won't fold anything that would raise an invalid operation.
+
+			// the algorithms round through an integer, so a negative value that rounds to zero gives +0 where the
+			// standard library and the builtins give -0. adding a zero gives the bits of the algorithms whichever way
+			// the value went, while a zero value keeps its sign.
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T algorithm_zero(T value, T result) noexcept
+			{
+				return (value == T(0)) ? result : result + T(0);
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constant_trunc(T value) noexcept
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return algorithm_zero(value, std::trunc(value));
+#else
+#if defined(CXCM_CONSTEXPR_BUILTINS)
+				if (isfinite(value))
+				{
+					if constexpr (std::is_same_v<T, float>)
+						return algorithm_zero(value, __builtin_truncf(value));
+					else if constexpr (std::is_same_v<T, double>)
+						return algorithm_zero(value, __builtin_trunc(value));
+					else
+						return algorithm_zero(value, __builtin_truncl(value));
+				}
+#endif
+				return constexpr_trunc(value);
+#endif
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constant_floor(T value) noexcept
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::floor(value);
+#else
+#if defined(CXCM_CONSTEXPR_BUILTINS)
+				if (isfinite(value))
+				{
+					if constexpr (std::is_same_v<T, float>)
+						return __builtin_floorf(value);
+					else if constexpr (std::is_same_v<T, double>)
+						return __builtin_floor(value);
+					else
+						return __builtin_floorl(value);
+				}
+#endif
+				return constexpr_floor(value);
+#endif
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constant_ceil(T value) noexcept
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return algorithm_zero(value, std::ceil(value));
+#else
+#if defined(CXCM_CONSTEXPR_BUILTINS)
+				if (isfinite(value))
+				{
+					if constexpr (std::is_same_v<T, float>)
+						return algorithm_zero(value, __builtin_ceilf(value));
+					else if constexpr (std::is_same_v<T, double>)
+						return algorithm_zero(value, __builtin_ceil(value));
+					else
+						return algorithm_zero(value, __builtin_ceill(value));
+				}
+#endif
+				return constexpr_ceil(value);
+#endif
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constant_round(T value) noexcept
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return algorithm_zero(value, std::round(value));
+#else
+#if defined(CXCM_CONSTEXPR_BUILTINS)
+				if (isfinite(value))
+				{
+					if constexpr (std::is_same_v<T, float>)
+						return algorithm_zero(value, __builtin_roundf(value));
+					else if constexpr (std::is_same_v<T, double>)
+						return algorithm_zero(value, __builtin_round(value));
+					else
+						return algorithm_zero(value, __builtin_roundl(value));
+				}
+#endif
+				return constexpr_round(value);
+#endif
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constant_fmod(T x, T y) noexcept
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::fmod(x, y);
+#else
+#if defined(CXCM_CONSTEXPR_BUILTINS)
+				if (isfinite(x) && isfinite(y) && (y != T(0)))
+				{
+					if constexpr (std::is_same_v<T, float>)
+						return __builtin_fmodf(x, y);
+					else if constexpr (std::is_same_v<T, double>)
+						return __builtin_fmod(x, y);
+					else
+						return __builtin_fmodl(x, y);
+				}
+#endif
+				return constexpr_fmod(x, y);
+#endif
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constant_sqrt(T value) noexcept
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_26)
+				return std::sqrt(value);
+#else
+#if defined(CXCM_CONSTEXPR_BUILTINS)
+				if (isfinite(value) && (value >= T(0)))
+				{
+					if constexpr (std::is_same_v<T, float>)
+						return __builtin_sqrtf(value);
+					else if constexpr (std::is_same_v<T, double>)
+						return __builtin_sqrt(value);
+					else
+						return __builtin_sqrtl(value);
+				}
+#endif
+				return constexpr_sqrt(value);
+#endif
+			}
+
+			//
+			// reproducible runtime dispatch
+			//
+
+			// the bits of the cxcm algorithms, from the hardware at runtime. rounding to an integral value and sqrt()
+			// are exact or correctly rounded wherever they run, so only the input the algorithms screen out and the sign
+			// of zero results need care. the algorithms round through an integer, which gives +0, hence the added zero.
+			// fmod() stays with the algorithm, which is faster than glibc's.
+
+			// nonzero, finite, and no bigger than largest_fractional_value, i.e., not screened out. for float and double
+			// that is one unsigned comparison of the magnitude bits, since NaN and infinity have the largest ones.
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr bool reproducible_fraction(T value) noexcept
+			{
+				if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+				{
+					using bits_type = std::conditional_t<std::is_same_v<T, float>, std::uint32_t, std::uint64_t>;
+					constexpr bits_type largest = std::bit_cast<bits_type>(limits::largest_fractional_value<T>);
+
+					const bits_type magnitude = std::bit_cast<bits_type>(value) & (~bits_type(0) >> 1);
+					return (magnitude - 1) < largest;
+				}
+				else
+				{
+					return isnormal_or_subnormal(value) && (relaxed::abs(value) <= limits::largest_fractional_value<T>);
+				}
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T reproducible_trunc(T value) noexcept
+			{
+				if (std::is_constant_evaluated() || !reproducible_fraction(value))
+					return constexpr_trunc(value);
+
+				return std::trunc(value) + T(0);
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T reproducible_floor(T value) noexcept
+			{
+				if (std::is_constant_evaluated() || !reproducible_fraction(value))
+					return constexpr_floor(value);
+
+				return std::floor(value) + T(0);
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T reproducible_ceil(T value) noexcept
+			{
+				if (std::is_constant_evaluated() || !reproducible_fraction(value))
+					return constexpr_ceil(value);
+
+				return std::ceil(value) + T(0);
+			}
+
+			// std::round() is a library call even where std::trunc() is one instruction. what truncation cut off is
+			// exact, as in relaxed::round().
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T reproducible_round(T value) noexcept
+			{
+				if (std::is_constant_evaluated() || !reproducible_fraction(value))
+					return constexpr_round(value);
+
+				const T truncated_value = std::trunc(value);
+				const T remainder = value - truncated_value;
+
+				if (remainder >= T(0.5f))
+					return truncated_value + T(1);
+
+				if (remainder <= T(-0.5f))
+					return truncated_value - T(1);
+
+				return truncated_value + T(0);
+			}
+
+			// std::nearbyint() follows the rounding mode, so halfway cases go up from the floor when it is odd
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T reproducible_round_even(T value) noexcept
+			{
+				if (std::is_constant_evaluated() || !reproducible_fraction(value))
+					return constexpr_round_even(value);
+
+				const T floor_value = std::floor(value);
+				const T remainder = value - floor_value;
+				const bool is_odd = (std::floor(floor_value * T(0.5f)) * T(2) != floor_value);
+
+				if ((remainder > T(0.5f)) || (is_odd && (remainder == T(0.5f))))
+					return floor_value + T(1);
+
+				return floor_value + T(0);
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T reproducible_fract(T value) noexcept
+			{
+				if (std::is_constant_evaluated() || !reproducible_fraction(value))
+					return constexpr_fract(value);
+
+				return value - (std::floor(value) + T(0));
+			}
+
+			// constexpr_sqrt() is correctly rounded, the same as the hardware
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T reproducible_sqrt(T value) noexcept
+			{
+				if (std::is_constant_evaluated() || !isnormal_or_subnormal(value) || (value < T(0)))
+					return constexpr_sqrt(value);
+
+				return std::sqrt(value);
+			}
+
+			// for float, one over the square root in double rounds to the same float as the newton steps. double
+			// stays with the dd_real steps.
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T reproducible_rsqrt(T value) noexcept
+			{
+				if constexpr (std::is_same_v<T, float>)
+				{
+					if (!std::is_constant_evaluated() && isnormal_or_subnormal(value) && (value > 0))
+						return static_cast<float>(1.0 / std::sqrt(static_cast<double>(value)));
+				}
+
+				return constexpr_rsqrt(value);
+			}
+
+		} // namespace detail
+
+		//
+		// abs(), fabs()
+		//
+
+
+		// absolute value
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T abs(T value) noexcept
+		{
+			auto new_value = cxcm::copysign(value, T(+1));
+
+#if !defined(NDEBUG) && defined(_MSC_VER)
+			if (isnan(new_value))
+			{
+				return detail::convert_to_quiet_nan(new_value);
+			}
+			else
+			{
+				return new_value;
+			}
+#else
+			return new_value;
+#endif
+		}
+
+		// don't know what to do if someone tries to negate the most negative number.
+		// standard says behavior is undefined if you can't represent the result by return type.
+		template <std::integral T>
+		constexpr T abs(T value)
+		{
+			if (value == std::numeric_limits<T>::min())
+			{
+				throw std::domain_error("negation of min value is not a valid integral value");
+			}
+
+			[[ likely ]] return relaxed::abs(value);
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T fabs(T value) noexcept
+		{
+			return cxcm::abs(value);
+		}
+
+		template <std::integral T>
+		constexpr double fabs(T value)
+		{
+			if (value == std::numeric_limits<T>::min())
+			{
+				throw std::domain_error("negation of min value is not a valid integral value");
+			}
+
+			[[ likely ]] return relaxed::fabs(value);
+		}
+
+		//
+		// trunc()
+		//
+
+		// rounds towards zero
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T trunc(T value) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return detail::constant_trunc(value);
+			}
+			else
+			{
+				CXCM_STATS_PATH("trunc", T, "std");
+				return std::trunc(value);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double trunc(T value) noexcept
+		{
+			return trunc(static_cast<double>(value));
+		}
+
+		//
+		// floor()
+		//
+
+		// rounds towards negative infinity
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T floor(T value) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return detail::constant_floor(value);
+			}
+			else
+			{
+				CXCM_STATS_PATH("floor", T, "std");
+				return std::floor(value);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double floor(T value) noexcept
+		{
+			return floor(static_cast<double>(value));
+		}
+
+		//
+		// ceil()
+		//
+
+		// rounds towards positive infinity
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T ceil(T value) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return detail::constant_ceil(value);
+			}
+			else
+			{
+				CXCM_STATS_PATH("ceil", T, "std");
+				return std::ceil(value);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double ceil(T value) noexcept
+		{
+			return ceil(static_cast<double>(value));
+		}
+
+		//
+		// round()
+		//
+
+		// rounds to nearest integral position, halfway cases away from zero
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T round(T value) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return detail::constant_round(value);
+			}
+			else
+			{
+				CXCM_STATS_PATH("round", T, "std");
+				return std::round(value);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double round(T value) noexcept
+		{
+			return round(static_cast<double>(value));
+		}
+
+		//
+		// fract()
+		//
+
+		// there is no standard c++ version of this, so always call constexpr version
+
+		// the fractional part of a floating point number - always non-negative.
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T fract(T value) noexcept
+		{
+			CXCM_STATS_PATH("fract", T, "cxcm");
+			return detail::constexpr_fract(value);
+		}
+
+		template <std::integral T>
+		constexpr double fract(T value) noexcept
+		{
+			return fract(static_cast<double>(value));
+		}
+
+		//
+		// fmod()
+		//
+
+		// the floating point remainder of division
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T fmod(T x, T y) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return detail::constant_fmod(x, y);
+			}
+			else
+			{
+				CXCM_STATS_PATH("fmod", T, "std");
+				return std::fmod(x, y);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double fmod(T x, T y) noexcept
+		{
+			return fmod(static_cast<double>(x), static_cast<double>(y));
+		}
+
+		//
+		// remainder(), remquo()
+		//
+
+		// IEEE remainder, x - n * y with n = x / y rounded to nearest, halfway cases towards even. always exact.
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T remainder(T x, T y) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::remainder(x, y);
+#else
+				return detail::constexpr_remainder(x, y);
+#endif
+			}
+			else
+			{
+				return std::remainder(x, y);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double remainder(T x, T y) noexcept
+		{
+			return remainder(static_cast<double>(x), static_cast<double>(y));
+		}
+
+		// the same as remainder(), also storing the low three bits of n, with the sign of x / y
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T remquo(T x, T y, int *quotient) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::remquo(x, y, quotient);
+#else
+				return detail::constexpr_remquo(x, y, quotient);
+#endif
+			}
+			else
+			{
+				return std::remquo(x, y, quotient);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double remquo(T x, T y, int *quotient) noexcept
+		{
+			return remquo(static_cast<double>(x), static_cast<double>(y), quotient);
+		}
+
+		//
+		// round_even()
+		//
+
+		// there is no standard c++ version of this, so always call constexpr version
+
+		// rounds to nearest integral position, halfway cases towards even
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T round_even(T value) noexcept
+		{
+			CXCM_STATS_PATH("round_even", T, "cxcm");
+			return detail::constexpr_round_even(value);
+		}
+
+		template <std::integral T>
+		constexpr double round_even(T value) noexcept
+		{
+			return round_even(static_cast<double>(value));
+		}
+
+		//
+		// lround(), llround(), lrint(), llrint(), ifloor(), iceil(), itrunc() - rounding to an integral type
+		//
+
+		// rounded straight to the integral type, without going back through floating-point. NaN converts to 0,
+		// and anything out of range saturates to the limits of the integral type.
+
+		namespace detail
+		{
+			// integral types that hold numbers
+			template <typename T>
+			concept integer_math_type = std::integral<T> && !std::is_same_v<std::remove_cv_t<T>, bool>;
+
+			enum class integer_rounding
+			{
+				truncate,
+				floor,
+				ceil,
+				away_from_zero,
+				to_even
+			};
+
+			template <integer_math_type I, integer_rounding Rounding, cxcm::concepts::basic_floating_point T>
+			constexpr I round_to_integer(T value) noexcept
+			{
+				constexpr I min_value = std::numeric_limits<I>::min();
+				constexpr I max_value = std::numeric_limits<I>::max();
+
+				// the limits + 1 are powers of two, so exact
+				constexpr T lower = static_cast<T>(min_value);
+				constexpr T upper = static_cast<T>(max_value / 2 + 1) * T(2);
+
+				// NaN fails both comparisons
+				if (!((value > lower) && (value < upper)))
+				{
+					if (cxcm::isnan(value))
+						return I(0);
+
+					return (value < upper) ? min_value : max_value;
+				}
+
+#if defined(__SSE4_1__)
+				// a single rounding instruction
+				if (!std::is_constant_evaluated() && (std::is_same_v<T, float> || std::is_same_v<T, double>))
+				{
+					if constexpr (Rounding == integer_rounding::floor)
+						return static_cast<I>(std::floor(value));
+					else if constexpr (Rounding == integer_rounding::ceil)
+						return (std::ceil(value) < upper) ? static_cast<I>(std::ceil(value)) : max_value;
+				}
+#endif
+
+				// in range, so this is the truncated value, and it converts back exactly
+				I result = static_cast<I>(value);
+
+				if constexpr (Rounding == integer_rounding::floor)
+				{
+					result -= static_cast<I>(value < static_cast<T>(result));
+				}
+				else if constexpr (Rounding == integer_rounding::ceil)
+				{
+					if ((value > static_cast<T>(result)) && (result < max_value))
+						++result;
+				}
+				else if constexpr (Rounding != integer_rounding::truncate)
+				{
+					// exact, the fractional part
+					const T difference = value - static_cast<T>(result);
+
+					if constexpr (Rounding == integer_rounding::away_from_zero)
+					{
+						if ((difference >= T(0.5)) && (result < max_value))
+							++result;
+						else if ((difference <= T(-0.5)) && (result > min_value))
+							--result;
+					}
+					else
+					{
+						if (((difference > T(0.5)) || ((difference == T(0.5)) && (result & 1))) && (result < max_value))
+							++result;
+						else if (((difference < T(-0.5)) || ((difference == T(-0.5)) && (result & 1))) && (result > min_value))
+							--result;
+					}
+				}
+
+				return result;
+			}
+
+		} // namespace detail
+
+		// rounds to nearest, halfway cases away from zero
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr long lround(T value) noexcept
+		{
+			return detail::round_to_integer<long, detail::integer_rounding::away_from_zero>(value);
+		}
+
+		template <std::integral T>
+		constexpr long lround(T value) noexcept
+		{
+			return lround(static_cast<double>(value));
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr long long llround(T value) noexcept
+		{
+			return detail::round_to_integer<long long, detail::integer_rounding::away_from_zero>(value);
+		}
+
+		template <std::integral T>
+		constexpr long long llround(T value) noexcept
+		{
+			return llround(static_cast<double>(value));
+		}
+
+		// rounds to nearest, halfway cases towards even. constant evaluation can't see the floating-point
+		// environment, so this always uses the default rounding mode, at runtime as well.
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr long lrint(T value) noexcept
+		{
+			return detail::round_to_integer<long, detail::integer_rounding::to_even>(value);
+		}
+
+		template <std::integral T>
+		constexpr long lrint(T value) noexcept
+		{
+			return lrint(static_cast<double>(value));
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr long long llrint(T value) noexcept
+		{
+			return detail::round_to_integer<long long, detail::integer_rounding::to_even>(value);
+		}
+
+		template <std::integral T>
+		constexpr long long llrint(T value) noexcept
+		{
+			return llrint(static_cast<double>(value));
+		}
+
+		// not in standard library. the same as static_cast<I>(floor(value)) etc. for values in range, e.g.,
+		// for grid indexing, int cell = cxcm::ifloor(x / cell_size);
+
+		template <detail::integer_math_type I = int, cxcm::concepts::basic_floating_point T>
+		constexpr I ifloor(T value) noexcept
+		{
+			return detail::round_to_integer<I, detail::integer_rounding::floor>(value);
+		}
+
+		template <detail::integer_math_type I = int, cxcm::concepts::basic_floating_point T>
+		constexpr I iceil(T value) noexcept
+		{
+			return detail::round_to_integer<I, detail::integer_rounding::ceil>(value);
+		}
+
+		template <detail::integer_math_type I = int, cxcm::concepts::basic_floating_point T>
+		constexpr I itrunc(T value) noexcept
+		{
+			return detail::round_to_integer<I, detail::integer_rounding::truncate>(value);
+		}
+
+		//
+		// sqrt()
+		//
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T sqrt(T value) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return detail::constant_sqrt(value);
+			}
+			else
+			{
+				CXCM_STATS_PATH("sqrt", T, "std");
+				return std::sqrt(value);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double sqrt(T value) noexcept
+		{
+			return sqrt(static_cast<double>(value));
+		}
+
+		//
+		// rsqrt() - inverse square root
+		//
+
+		// there is no standard c++ version of this, so always call constexpr version
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T rsqrt(T value) noexcept
+		{
+			CXCM_STATS_PATH("rsqrt", T, "cxcm");
+			return detail::constexpr_rsqrt(value);
+		}
+
+		template <std::integral T>
+		constexpr double rsqrt(T value) noexcept
+		{
+			return rsqrt(static_cast<double>(value));
+		}
+
+		//
+		// fast_rsqrt() - fast good approximation to inverse square root
+		//
+
+		// there is no standard c++ version of this, so always call constexpr version
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T fast_rsqrt(T value) noexcept
+		{
+			CXCM_STATS_PATH("fast_rsqrt", T, "cxcm");
+			return detail::constexpr_fast_rsqrt(value);
+		}
+
+		template <std::integral T>
+		constexpr double fast_rsqrt(T value) noexcept
+		{
+			return fast_rsqrt(static_cast<double>(value));
+		}
+
+		//
+		// frexp(), ldexp(), scalbn(), ilogb(), logb(), nextafter(), nexttoward() - exponent manipulation
+		//
+
+		namespace detail
+		{
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_frexp(T value, int *exponent) noexcept
+			{
+				if ((value == 0) || cxcm::isnan(value) || cxcm::isinf(value))
+				{
+					*exponent = 0;
+					return value;
+				}
+
+				const unpacked_float parts = unpack(value);
+				*exponent = parts.exponent + 64;
+
+				return pack<T>(parts.negative, -64, parts.significand);
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_ldexp(T value, int exponent) noexcept
+			{
+				if ((value == 0) || cxcm::isnan(value) || cxcm::isinf(value))
+					return value;
+
+				// far enough out that every value overflows or underflows, and it can't overflow an int
+				constexpr int exponent_limit = 4 * std::numeric_limits<T>::max_exponent;
+				exponent = (exponent > exponent_limit) ? exponent_limit : ((exponent < -exponent_limit) ? -exponent_limit : exponent);
+
+				const unpacked_float parts = unpack(value);
+
+				return pack<T>(parts.negative, parts.exponent + exponent, parts.significand);
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr int constexpr_ilogb(T value) noexcept
+			{
+				if (value == 0)
+					return FP_ILOGB0;
+
+				if (cxcm::isnan(value))
+					return FP_ILOGBNAN;
+
+				if (cxcm::isinf(value))
+					return std::numeric_limits<int>::max();
+
+				return unpack(value).exponent + 63;
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_logb(T value) noexcept
+			{
+				if (value == 0)
+					return -std::numeric_limits<T>::infinity();
+
+				if (cxcm::isnan(value))
+					return value;
+
+				if (cxcm::isinf(value))
+					return std::numeric_limits<T>::infinity();
+
+				return static_cast<T>(unpack(value).exponent + 63);
+			}
+
+			// the neighbor of a finite non-zero value or infinity, one step away from or towards zero
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T adjacent(T value, bool away_from_zero) noexcept
+			{
+				if constexpr (std::is_same_v<T, long double> && bitwise::is_x87_long_double)
+				{
+					const auto bits = bitwise::to_x87_bits(value);
+					const std::uint16_t sign = bits.sign_exponent & bitwise::x87_sign_mask;
+					std::uint64_t significand = bits.significand;
+					int exponent_field = bits.sign_exponent & bitwise::x87_exponent_mask;
+
+					if (away_from_zero)
+					{
+						++significand;
+						if (significand == 0)
+						{
+							significand = bitwise::x87_integer_bit;
+							++exponent_field;
+						}
+						else if ((exponent_field == 0) && (significand == bitwise::x87_integer_bit))
+						{
+							exponent_field = 1;
+						}
+					}
+					else
+					{
+						if ((exponent_field > 0) && (significand == bitwise::x87_integer_bit))
+						{
+							--exponent_field;
+							significand = (exponent_field == 0) ? (bitwise::x87_integer_bit - 1) : ~std::uint64_t(0);
+						}
+						else
+						{
+							--significand;
+						}
+					}
+
+					return bitwise::from_x87_bits(significand, static_cast<std::uint16_t>(sign | exponent_field));
+				}
+				else
+				{
+					// the magnitude bits are ordered, so the next one out is one more
+					using bits_type = std::conditional_t<(sizeof(T) == 4), std::uint32_t, std::uint64_t>;
+
+					const bits_type bits = std::bit_cast<bits_type>(value);
+
+					return std::bit_cast<T>(static_cast<bits_type>(away_from_zero ? (bits + 1) : (bits - 1)));
+				}
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_nextafter(T from, T to) noexcept
+			{
+				if (cxcm::isnan(from) || cxcm::isnan(to))
+					return from + to;
+
+				if (from == to)
+					return to;
+
+				if (from == 0)
+					return cxcm::copysign(std::numeric_limits<T>::denorm_min(), to);
+
+				return adjacent(from, (to > from) == (from > 0));
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr T constexpr_nexttoward(T from, long double to) noexcept
+			{
+				if (cxcm::isnan(from) || cxcm::isnan(to))
+					return static_cast<T>(static_cast<long double>(from) + to);
+
+				if (static_cast<long double>(from) == to)
+					return static_cast<T>(to);
+
+				return constexpr_nextafter(from, (static_cast<long double>(from) < to) ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity());
+			}
+
+		} // namespace detail
+
+		// splits value into a fraction in [0.5, 1) and a power of two. zero, infinity, and NaN are returned as is,
+		// with an exponent of 0.
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T frexp(T value, int *exponent) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::frexp(value, exponent);
+#else
+				return detail::constexpr_frexp(value, exponent);
+#endif
+			}
+			else
+			{
+				return std::frexp(value, exponent);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double frexp(T value, int *exponent) noexcept
+		{
+			return frexp(static_cast<double>(value), exponent);
+		}
+
+		// value * 2^exponent, with a single rounding if the result is subnormal
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T ldexp(T value, int exponent) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::ldexp(value, exponent);
+#else
+				return detail::constexpr_ldexp(value, exponent);
+#endif
+			}
+			else
+			{
+				return std::ldexp(value, exponent);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double ldexp(T value, int exponent) noexcept
+		{
+			return ldexp(static_cast<double>(value), exponent);
+		}
+
+		// the radix is 2, so the same as ldexp()
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T scalbn(T value, int exponent) noexcept
+		{
+			return cxcm::ldexp(value, exponent);
+		}
+
+		template <std::integral T>
+		constexpr double scalbn(T value, int exponent) noexcept
+		{
+			return cxcm::ldexp(static_cast<double>(value), exponent);
+		}
+
+		// the unbiased exponent, as if the value were normalized. FP_ILOGB0 for zero, FP_ILOGBNAN for NaN, and INT_MAX
+		// for infinity.
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr int ilogb(T value) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::ilogb(value);
+#else
+				return detail::constexpr_ilogb(value);
+#endif
+			}
+			else
+			{
+				return std::ilogb(value);
+			}
+		}
+
+		template <std::integral T>
+		constexpr int ilogb(T value) noexcept
+		{
+			return ilogb(static_cast<double>(value));
+		}
+
+		// the same as ilogb() as a floating-point value. -infinity for zero and infinity for infinity.
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T logb(T value) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::logb(value);
+#else
+				return detail::constexpr_logb(value);
+#endif
+			}
+			else
+			{
+				return std::logb(value);
+			}
+		}
+
+		template <std::integral T>
+		constexpr double logb(T value) noexcept
+		{
+			return logb(static_cast<double>(value));
+		}
+
+		// the next representable value after from in the direction of to
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T nextafter(T from, T to) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::nextafter(from, to);
+#else
+				return detail::constexpr_nextafter(from, to);
+#endif
+			}
+			else
+			{
+				return std::nextafter(from, to);
+			}
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		constexpr T nexttoward(T from, long double to) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+				return std::nexttoward(from, to);
+#else
+				return detail::constexpr_nexttoward(from, to);
+#endif
+			}
+			else
+			{
+				return std::nexttoward(from, to);
+			}
+		}
+
+		//
+		// isqrt(), icbrt(), ilog2(), ipow() - exact integer math, not in standard library
+		//
+
+		// the integral overloads of sqrt() and friends go through double, which can't hold every 64-bit value.
+		// these stay in the integral type and are exact for every value.
+
+		namespace detail
+		{
+			// isqrt(), icbrt(), and ipow() work in 64 bits, so wider types such as __int128 are left out rather than
+			// narrowed. ilog2() takes them.
+			template <typename T>
+			concept integer_root_type = integer_math_type<T> && (sizeof(T) <= sizeof(std::uint64_t));
+
+			// the magnitude of any integral value fits the unsigned type of the same size
+			template <integer_math_type T>
+			constexpr std::make_unsigned_t<T> magnitude(T value) noexcept
+			{
+				using U = std::make_unsigned_t<T>;
+
+				return (value < 0) ? static_cast<U>(U(0) - static_cast<U>(value)) : static_cast<U>(value);
+			}
+
+			// Newton's method from 2^ceil(bit_width / 2), which is never below the root, so it decreases to the
+			// floor of the root and stops
+			constexpr std::uint64_t constexpr_isqrt(std::uint64_t value) noexcept
+			{
+				if (value < 2)
+					return value;
+
+				std::uint64_t root = std::uint64_t(1) << ((std::bit_width(value) + 1) / 2);
+				while (true)
+				{
+					const std::uint64_t next = (root + value / root) / 2;
+					if (next >= root)
+						return root;
+
+					root = next;
+				}
+			}
+
+			// the double square root is within one of the answer, then fix it up. below 2^52 it is already exact.
+			inline std::uint64_t runtime_isqrt(std::uint64_t value) noexcept
+			{
+				std::uint64_t root = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(value)));
+				if (root > 0xFFFFFFFFull)
+					root = 0xFFFFFFFFull;
+
+				if (root * root > value)
+					--root;
+				else if (value - root * root > 2 * root)
+					++root;
+
+				return root;
+			}
+
+			// digit by digit, three bits at a time, starting at the highest set group of bits
+			constexpr std::uint64_t constexpr_icbrt(std::uint64_t value) noexcept
+			{
+				if (value == 0)
+					return 0;
+
+				std::uint64_t root = 0;
+				for (int shift = ((std::bit_width(value) - 1) / 3) * 3; shift >= 0; shift -= 3)
+				{
+					root *= 2;
+
+					// (root + 1)^3 - root^3, scaled to this group of bits. it can't overflow before the top group.
+					const std::uint64_t step = 3 * root * (root + 1) + 1;
+					if ((value >> shift) >= step)
+					{
+						value -= step << shift;
+						++root;
+					}
+				}
+
+				return root;
+			}
+
+			// the double cube root is within one of the answer, then fix it up. 2642245 is the largest 64-bit cube root.
+			inline std::uint64_t runtime_icbrt(std::uint64_t value) noexcept
+			{
+				std::uint64_t root = static_cast<std::uint64_t>(std::cbrt(static_cast<double>(value)));
+				if (root > 2642245)
+					root = 2642245;
+
+				if (root * root * root > value)
+					--root;
+				else if ((root < 2642245) && ((root + 1) * (root + 1) * (root + 1) <= value))
+					++root;
+
+				return root;
+			}
+
+			// product, or false if it is larger than limit. both factors must be no larger than limit.
+			constexpr bool multiply_within(std::uint64_t &product, std::uint64_t factor, std::uint64_t limit) noexcept
+			{
+				if ((factor != 0) && (product > limit / factor))
+					return false;
+
+				product *= factor;
+
+				return true;
+			}
+
+		} // namespace detail
+
+		// floor of the square root. negative values have no square root.
+		template <detail::integer_root_type T>
+		constexpr T isqrt(T value)
+		{
+			if (value < 0)
+			{
+				throw std::domain_error("square root of a negative value is not a valid integral value");
+			}
+
+			if (std::is_constant_evaluated())
+			{
+				return static_cast<T>(detail::constexpr_isqrt(static_cast<std::uint64_t>(value)));
+			}
+			else
+			{
+				if constexpr (sizeof(T) <= 4)
+					return static_cast<T>(std::sqrt(static_cast<double>(value)));
+				else
+					return static_cast<T>(detail::runtime_isqrt(static_cast<std::uint64_t>(value)));
+			}
+		}
+
+		// cube root rounded towards zero, so icbrt(-value) == -icbrt(value)
+		template <detail::integer_root_type T>
+		constexpr T icbrt(T value) noexcept
+		{
+			const std::uint64_t magnitude = detail::magnitude(value);
+			std::uint64_t root = 0;
+
+			if (std::is_constant_evaluated())
+				root = detail::constexpr_icbrt(magnitude);
+			else
+				root = detail::runtime_icbrt(magnitude);
+
+			return (value < 0) ? static_cast<T>(-static_cast<T>(root)) : static_cast<T>(root);
+		}
+
+		// floor of the base 2 logarithm, the position of the highest set bit. zero and negative values return -1.
+		template <detail::integer_math_type T>
+		constexpr int ilog2(T value) noexcept
+		{
+			if (value <= 0)
+				return -1;
+
+			return std::bit_width(static_cast<std::make_unsigned_t<T>>(value)) - 1;
+		}
+
+		// base^exponent by repeated squaring. ipow(0, 0) is 1. it is an error if the result doesn't fit in T.
+		template <detail::integer_root_type T>
+		constexpr T ipow(T base, unsigned int exponent)
+		{
+			const bool negative = (base < 0) && (exponent & 1);
+			const std::uint64_t limit = negative ? detail::magnitude(std::numeric_limits<T>::min()) : static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+
+			std::uint64_t result = 1;
+			std::uint64_t power = detail::magnitude(base);
+			bool fits = true;
+
+			while (exponent != 0)
+			{
+				if (exponent & 1)
+					fits = fits && (power <= limit) && detail::multiply_within(result, power, limit);
+
+				exponent >>= 1;
+
+				// base^2 only matters if a higher bit is set, and then the result is at least that large
+				if ((exponent != 0) && (power > 1))
+					fits = fits && detail::multiply_within(power, power, limit);
+			}
+
+			if (!fits)
+			{
+				throw std::domain_error("integral power is too large for the integral type");
+			}
+
+			return negative ? static_cast<T>(std::uint64_t(0) - result) : static_cast<T>(result);
+		}
+
+		//
+		// reproducible_sum() - not in standard library
+		//
+
+		namespace detail
+		{
+			//
+			// exponent_upper_bound()
+			//
+
+			// smallest e such that |value| < 2^e for finite value. zero and subnormals report the smallest normal exponent.
+			constexpr int exponent_upper_bound(double value) noexcept
+			{
+				const int biased_exponent = static_cast<int>((std::bit_cast<unsigned long long>(value) >> 52) & 0x7FF);
+
+				return (biased_exponent == 0) ? -1022 : (biased_exponent - 1022);
+			}
+
+			//
+			// power_of_two()
+			//
+
+			// exact 2^exponent, built from the bits. underflows to zero and overflows to infinity.
+			constexpr double power_of_two(int exponent) noexcept
+			{
+				if (exponent > 1023)
+					return std::numeric_limits<double>::infinity();
+				else if (exponent >= -1022)
+					return std::bit_cast<double>(static_cast<unsigned long long>(exponent + 1023) << 52);
+				else if (exponent >= -1074)
+					return std::bit_cast<double>(1ULL << (exponent + 1074));
+
+				return 0.0;
+			}
+
+			// pre-rounded summation in the style of Demmel and Nguyen, "Fast Reproducible Floating-Point Summation", 2013.
+			//
+			// every value is split against a fixed set of boundaries, 2^k, that only depend on the largest magnitude and
+			// on the number of values. the piece extracted at each boundary lies on a grid fixed by that boundary, so the
+			// sum of those pieces is exact no matter what order they are added in. each fold recovers about 51 - log2(n)
+			// more bits of the residuals, and the folds are combined with the dd_real error-free transforms at the end.
+			constexpr int reproducible_fold_count = 3;
+
+			struct reproducible_sum_screen
+			{
+				double max_abs = 0.0;
+				bool has_nan = false;
+				bool has_positive_infinity = false;
+				bool has_negative_infinity = false;
+			};
+
+			struct reproducible_sum_boundaries
+			{
+				int scale_exponent = 0;
+				double boundary[reproducible_fold_count]{};
+			};
+
+			struct reproducible_sum_state
+			{
+				double fold[reproducible_fold_count]{};
+			};
+
+			// first pass: order independent screening of the input
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr void screen_reproducible_sum(std::span<const T> values, reproducible_sum_screen &screen) noexcept
+			{
+				for (T value : values)
+				{
+					const double boosted_value = value;
+
+					if (isnan(boosted_value))
+						screen.has_nan = true;
+					else if (boosted_value == std::numeric_limits<double>::infinity())
+						screen.has_positive_infinity = true;
+					else if (boosted_value == -std::numeric_limits<double>::infinity())
+						screen.has_negative_infinity = true;
+					else if (relaxed::abs(boosted_value) > screen.max_abs)
+						screen.max_abs = relaxed::abs(boosted_value);
+				}
+			}
+
+			constexpr void merge_reproducible_sum_screen(reproducible_sum_screen &screen, const reproducible_sum_screen &other) noexcept
+			{
+				screen.max_abs = (other.max_abs > screen.max_abs) ? other.max_abs : screen.max_abs;
+				screen.has_nan = screen.has_nan || other.has_nan;
+				screen.has_positive_infinity = screen.has_positive_infinity || other.has_positive_infinity;
+				screen.has_negative_infinity = screen.has_negative_infinity || other.has_negative_infinity;
+			}
+
+			constexpr reproducible_sum_boundaries make_reproducible_sum_boundaries(double max_abs, std::size_t count) noexcept
+			{
+				reproducible_sum_boundaries boundaries;
+
+				// count <= 2^count_exponent, so the sum of count extracted pieces of magnitude <= 2^exponent stays
+				// below half the boundary, where every partial sum is representable on the boundary's grid.
+				const int count_exponent = static_cast<int>(std::bit_width(count));
+				int exponent = exponent_upper_bound(max_abs);
+
+				// the boundary must not overflow, so scale the input down by an exact power of two if necessary
+				if (exponent + count_exponent + 2 > 1023)
+				{
+					boundaries.scale_exponent = 1023 - (exponent + count_exponent + 2);
+					exponent += boundaries.scale_exponent;
+				}
+
+				for (int i = 0; i < reproducible_fold_count; ++i)
+				{
+					// keep the boundary normal, 2^-1022 already extracts everything on the subnormal grid
+					const int boundary_exponent = exponent + count_exponent + 2;
+					boundaries.boundary[i] = power_of_two((boundary_exponent < -1022) ? -1022 : boundary_exponent);
+
+					// the residual is at most half an ulp of the boundary
+					exponent = boundary_exponent - 53;
+				}
+
+				return boundaries;
+			}
+
+			// second pass: extract each value against the boundaries and accumulate the exact pieces
+
+			// make sure this isn't optimized away if used with fast-math
+
+#if defined(_MSC_VER) || defined(__clang__)
+#pragma float_control(precise, on, push)
+#endif
+
+			template <cxcm::concepts::basic_floating_point T>
+#if defined(__GNUC__) && !defined(__clang__)
+			__attribute__((optimize("-fno-fast-math")))
+#endif
+			constexpr void accumulate_reproducible_sum(std::span<const T> values, const reproducible_sum_boundaries &boundaries,
+													   reproducible_sum_state &state) noexcept
+			{
+				const double scale = power_of_two(boundaries.scale_exponent);
+
+				for (T value : values)
+				{
+					double residual = static_cast<double>(value) * scale;
+
+					for (int i = 0; i < reproducible_fold_count; ++i)
+					{
+						const double piece = (boundaries.boundary[i] + residual) - boundaries.boundary[i];
+						state.fold[i] += piece;
+						residual -= piece;
+					}
+				}
+			}
+
+#if defined(_MSC_VER) || defined(__clang__)
+#pragma float_control(pop)
+#endif
+
+			// the folds are exact, so merging partial states in any order gives identical bits
+			constexpr void merge_reproducible_sum_state(reproducible_sum_state &state, const reproducible_sum_state &other) noexcept
+			{
+				for (int i = 0; i < reproducible_fold_count; ++i)
+					state.fold[i] += other.fold[i];
+			}
+
+			constexpr double finish_reproducible_sum(const reproducible_sum_screen &screen, const reproducible_sum_boundaries &boundaries,
+													 const reproducible_sum_state &state) noexcept
+			{
+				if (screen.has_nan || (screen.has_positive_infinity && screen.has_negative_infinity))
+					return std::numeric_limits<double>::quiet_NaN();
+				else if (screen.has_positive_infinity)
+					return std::numeric_limits<double>::infinity();
+				else if (screen.has_negative_infinity)
+					return -std::numeric_limits<double>::infinity();
+
+				// fixed order of combination
+				auto total = dd_real::dd_real(state.fold[0]);
+				for (int i = 1; i < reproducible_fold_count; ++i)
+					total = total + state.fold[i];
+
+				return static_cast<double>(total) * power_of_two(-boundaries.scale_exponent);
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			constexpr double serial_reproducible_sum(std::span<const T> values) noexcept
+			{
+				reproducible_sum_screen screen;
+				screen_reproducible_sum(values, screen);
+
+				const auto boundaries = make_reproducible_sum_boundaries(screen.max_abs, values.size());
+
+				reproducible_sum_state state;
+				if (screen.max_abs != 0.0)
+					accumulate_reproducible_sum(values, boundaries, state);
+
+				return finish_reproducible_sum(screen, boundaries, state);
+			}
+
+			// splits values into thread_count contiguous chunks and runs work(chunk_index, chunk) on each, one per thread
+			template <typename T, typename Work>
+			void run_chunks_in_parallel(std::span<const T> values, unsigned int thread_count, Work work)
+			{
+				const std::size_t chunk_size = (values.size() + thread_count - 1) / thread_count;
+				auto chunk = [&](unsigned int index)
+				{
+					const std::size_t first = std::min(values.size(), index * chunk_size);
+					return values.subspan(first, std::min(chunk_size, values.size() - first));
+				};
+
+				std::vector<std::thread> threads;
+				threads.reserve(thread_count - 1);
+
+				for (unsigned int i = 1; i < thread_count; ++i)
+					threads.emplace_back([&work, &chunk, i]() { work(i, chunk(i)); });
+
+				work(0U, chunk(0));
+
+				for (auto &thread : threads)
+					thread.join();
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			double parallel_reproducible_sum(std::span<const T> values, unsigned int thread_count)
+			{
+				// not worth starting a thread for less than this many values
+				constexpr std::size_t minimum_values_per_thread = 16384;
+
+				if (thread_count == 0)
+					thread_count = std::max(1U, std::thread::hardware_concurrency());
+
+				thread_count = static_cast<unsigned int>(std::min<std::size_t>(thread_count, values.size() / minimum_values_per_thread));
+
+				if (thread_count <= 1)
+					return serial_reproducible_sum(values);
+
+				std::vector<reproducible_sum_screen> screens(thread_count);
+				run_chunks_in_parallel(values, thread_count,
+									   [&screens](unsigned int index, std::span<const T> chunk) { screen_reproducible_sum(chunk, screens[index]); });
+
+				for (unsigned int i = 1; i < thread_count; ++i)
+					merge_reproducible_sum_screen(screens[0], screens[i]);
+
+				const auto boundaries = make_reproducible_sum_boundaries(screens[0].max_abs, values.size());
+
+				std::vector<reproducible_sum_state> states(thread_count);
+				if (screens[0].max_abs != 0.0)
+				{
+					run_chunks_in_parallel(values, thread_count,
+										   [&states, &boundaries](unsigned int index, std::span<const T> chunk) { accumulate_reproducible_sum(chunk, boundaries, states[index]); });
+				}
+
+				for (unsigned int i = 1; i < thread_count; ++i)
+					merge_reproducible_sum_state(states[0], states[i]);
+
+				return finish_reproducible_sum(screens[0], boundaries, states[0]);
+			}
+
+		}	// namespace detail
+
+		// sum that gives identical bits regardless of the order of the values, how they are chunked, or how many
+		// threads are used. the folds carry roughly 150 - 3 * log2(n) bits, so it is usually much more accurate
+		// than a naive sum as well.
+		constexpr double reproducible_sum(std::span<const double> values) noexcept
+		{
+			return detail::serial_reproducible_sum(values);
+		}
+
+		constexpr float reproducible_sum(std::span<const float> values) noexcept
+		{
+			return static_cast<float>(detail::serial_reproducible_sum(values));
+		}
+
+		// multi-threaded, thread_count of 0 uses std::thread::hardware_concurrency(). same bits as the single-threaded version.
+		inline double reproducible_sum(std::span<const double> values, unsigned int thread_count)
+		{
+			return detail::parallel_reproducible_sum(values, thread_count);
+		}
+
+		inline float reproducible_sum(std::span<const float> values, unsigned int thread_count)
+		{
+			return static_cast<float>(detail::parallel_reproducible_sum(values, thread_count));
+		}
+
+		//
+		// horner(), estrin(), comp_horner() - polynomial evaluation, not in standard library
+		//
+
+		// coefficients[i] is the coefficient of x^i
+
+		// Horner's scheme, the fewest operations
+		template <cxcm::concepts::basic_floating_point T, std::size_t N>
+		constexpr T horner(const std::array<T, N> &coefficients, T x) noexcept
+		{
+			if constexpr (N == 0)
+			{
+				return T(0);
+			}
+			else
+			{
+				T result = coefficients[N - 1];
+
+				for (std::size_t i = N - 1; i-- > 0;)
+					result = result * x + coefficients[i];
+
+				return result;
+			}
+		}
+
+		// Estrin's scheme, the same accuracy as Horner's scheme, but with much shorter dependency chains
+		template <cxcm::concepts::basic_floating_point T, std::size_t N>
+		constexpr T estrin(const std::array<T, N> &coefficients, T x) noexcept
+		{
+			if constexpr (N == 0)
+			{
+				return T(0);
+			}
+			else
+			{
+				std::array<T, N> terms = coefficients;
+				std::size_t term_count = N;
+				T power = x;
+
+				// combine adjacent pairs of terms, squaring the power each level
+				while (term_count > 1)
+				{
+					const std::size_t pair_count = term_count / 2;
+
+					for (std::size_t i = 0; i < pair_count; ++i)
+						terms[i] = terms[2 * i] + terms[2 * i + 1] * power;
+
+					if (term_count % 2)
+					{
+						terms[pair_count] = terms[term_count - 1];
+						term_count = pair_count + 1;
+					}
+					else
+					{
+						term_count = pair_count;
+					}
+
+					power *= power;
+				}
+
+				return terms[0];
+			}
+		}
+
+		// compensated Horner's scheme, "Compensated Horner Scheme", Graillat, Langlois, and Louvet, 2005.
+		// the result is as accurate as if computed with twice the working precision and then rounded, which
+		// matters when evaluating near a root, where Horner's scheme loses all accuracy.
+		//
+		// float uses double internally, double uses the dd_real error-free transforms internally, and long double
+		// uses the same error-free transforms in its own precision
+		template <cxcm::concepts::basic_floating_point T, std::size_t N>
+		constexpr T comp_horner(const std::array<T, N> &coefficients, T x) noexcept
+		{
+			if constexpr (N == 0)
+			{
+				return T(0);
+			}
+			else if constexpr (std::is_same_v<T, double>)
+			{
+				double result = coefficients[N - 1];
+				double correction = 0.0;
+
+				for (std::size_t i = N - 1; i-- > 0;)
+				{
+					double product_error = 0.0;
+					double sum_error = 0.0;
+
+					const double product = dd_real::two_prod(result, x, product_error);
+					result = dd_real::two_sum(product, coefficients[i], sum_error);
+					correction = correction * x + (product_error + sum_error);
+				}
+
+				return result + correction;
+			}
+			else if constexpr (std::is_same_v<T, float>)
+			{
+				const double boosted_x = x;
+				double result = coefficients[N - 1];
+
+				for (std::size_t i = N - 1; i-- > 0;)
+					result = result * boosted_x + coefficients[i];
+
+				return static_cast<float>(result);
+			}
+			else if constexpr (bitwise::is_double_long_double)
+			{
+				std::array<double, N> narrowed_coefficients{};
+				for (std::size_t i = 0; i < N; ++i)
+					narrowed_coefficients[i] = static_cast<double>(coefficients[i]);
+
+				return comp_horner(narrowed_coefficients, static_cast<double>(x));
+			}
+			else
+			{
+				auto two_sum = [](long double a, long double b, long double &error)
+				{
+					const long double s = a + b;
+					const long double v = s - a;
+					error = (a - (s - v)) + (b - v);
+					return s;
+				};
+
+				// split the 64-bit significand into two 32-bit halves
+				auto split = [](long double a, long double &high, long double &low)
+				{
+					const long double temp = 4294967297.0L * a;				// 4294967297.0 = 2^32 + 1
+					high = temp - (temp - a);
+					low = a - high;
+				};
+
+				auto two_prod = [&split](long double a, long double b, long double &error)
+				{
+					long double a_high = 0.0L;
+					long double a_low = 0.0L;
+					long double b_high = 0.0L;
+					long double b_low = 0.0L;
+
+					const long double p = a * b;
+					split(a, a_high, a_low);
+					split(b, b_high, b_low);
+					error = ((a_high * b_high - p) + a_high * b_low + a_low * b_high) + a_low * b_low;
+					return p;
+				};
+
+				long double result = coefficients[N - 1];
+				long double correction = 0.0L;
+
+				for (std::size_t i = N - 1; i-- > 0;)
+				{
+					long double product_error = 0.0L;
+					long double sum_error = 0.0L;
+
+					const long double product = two_prod(result, x, product_error);
+					result = two_sum(product, coefficients[i], sum_error);
+					correction = correction * x + (product_error + sum_error);
+				}
+
+				return result + correction;
+			}
+		}
+
+		//
+		// remez() - compile time minimax polynomial coefficients, not in standard library
+		//
+
+		namespace detail
+		{
+			// cosine of t in [0, pi], only good enough to place the chebyshev nodes that start the exchange
+			constexpr double remez_cos(double t) noexcept
+			{
+				constexpr double pi = 3.141592653589793238462643383279502884;
+
+				const bool is_negated = (t > pi / 2);
+				if (is_negated)
+					t = pi - t;
+
+				const double t_squared = t * t;
+				double term = 1.0;
+				double sum = 1.0;
+
+				for (int k = 1; k < 12; ++k)
+				{
+					term *= -t_squared / static_cast<double>((2 * k - 1) * (2 * k));
+					sum += term;
+				}
+
+				return is_negated ? -sum : sum;
+			}
+
+			// the error that will actually be seen, using the rounded coefficients
+			template <std::size_t N, typename Function>
+			constexpr double remez_error(const std::array<double, N> &coefficients, Function f, double x)
+			{
+				return horner(coefficients, x) - static_cast<double>(f(x));
+			}
+
+			// solve p(x_i) + (-1)^i * E = f(x_i) for the coefficients of p and the levelled error E, in dd_real
+			// because the monomial basis makes the system badly conditioned.
+			template <std::size_t Degree, typename Function>
+			constexpr std::array<double, Degree + 1> remez_solve(const std::array<double, Degree + 2> &reference, Function f)
+			{
+				constexpr std::size_t unknown_count = Degree + 2;
+
+				std::array<std::array<dd_real::dd_real, unknown_count + 1>, unknown_count> system{};
+
+				for (std::size_t i = 0; i < unknown_count; ++i)
+				{
+					auto power = dd_real::dd_real(1.0);
+					for (std::size_t j = 0; j <= Degree; ++j)
+					{
+						system[i][j] = power;
+						power = power * reference[i];
+					}
+
+					system[i][Degree + 1] = dd_real::dd_real((i % 2) ? -1.0 : 1.0);
+					system[i][unknown_count] = dd_real::dd_real(static_cast<double>(f(reference[i])));
+				}
+
+				// gaussian elimination with partial pivoting
+				for (std::size_t column = 0; column < unknown_count; ++column)
+				{
+					std::size_t pivot = column;
+					for (std::size_t row = column + 1; row < unknown_count; ++row)
+					{
+						if (relaxed::abs(system[row][column][0]) > relaxed::abs(system[pivot][column][0]))
+							pivot = row;
+					}
+
+					std::swap(system[column], system[pivot]);
+
+					for (std::size_t row = column + 1; row < unknown_count; ++row)
+					{
+						const auto factor = system[row][column] / system[column][column];
+						for (std::size_t j = column; j <= unknown_count; ++j)
+							system[row][j] -= factor * system[column][j];
+					}
+				}
+
+				std::array<dd_real::dd_real, unknown_count> solution{};
+				for (std::size_t row = unknown_count; row-- > 0;)
+				{
+					auto value = system[row][unknown_count];
+					for (std::size_t j = row + 1; j < unknown_count; ++j)
+						value -= system[row][j] * solution[j];
+
+					solution[row] = value / system[row][row];
+				}
+
+				std::array<double, Degree + 1> coefficients{};
+				for (std::size_t j = 0; j <= Degree; ++j)
+					coefficients[j] = static_cast<double>(solution[j]);
+
+				return coefficients;
+			}
+
+			// bisection for the zero of the error between two points where it changes sign
+			template <std::size_t N, typename Function>
+			constexpr double remez_zero(const std::array<double, N> &coefficients, Function f, double lo, double hi)
+			{
+				const bool lo_is_negative = (remez_error(coefficients, f, lo) < 0.0);
+
+				for (int i = 0; i < 64; ++i)
+				{
+					const double mid = lo + (hi - lo) / 2;
+					if ((mid == lo) || (mid == hi))
+						break;
+
+					if ((remez_error(coefficients, f, mid) < 0.0) == lo_is_negative)
+						lo = mid;
+					else
+						hi = mid;
+				}
+
+				return lo + (hi - lo) / 2;
+			}
+
+			// golden section search for the largest magnitude of the error between two zeros
+			template <std::size_t N, typename Function>
+			constexpr double remez_extremum(const std::array<double, N> &coefficients, Function f, double lo, double hi)
+			{
+				constexpr double inverse_phi = 0.618033988749894848204586834365638118;
+
+				auto magnitude = [&](double x) { return relaxed::abs(remez_error(coefficients, f, x)); };
+
+				double x1 = hi - inverse_phi * (hi - lo);
+				double x2 = lo + inverse_phi * (hi - lo);
+				double m1 = magnitude(x1);
+				double m2 = magnitude(x2);
+
+				for (int i = 0; i < 40; ++i)
+				{
+					if (m1 < m2)
+					{
+						lo = x1;
+						x1 = x2;
+						m1 = m2;
+						x2 = lo + inverse_phi * (hi - lo);
+						m2 = magnitude(x2);
+					}
+					else
+					{
+						hi = x2;
+						x2 = x1;
+						m2 = m1;
+						x1 = hi - inverse_phi * (hi - lo);
+						m1 = magnitude(x1);
+					}
+				}
+
+				return (m1 < m2) ? x2 : x1;
+			}
+
+		}	// namespace detail
+
+		// minimax polynomial coefficients, coefficients[i] multiplies x^i (ready for horner()), of the given degree
+		// that approximate f on [lo, hi], minimizing the largest absolute error. f can be any constexpr callable
+		// that takes a double, e.g., a lambda calling cxcm functions.
+		//
+		// each exchange step evaluates f and the polynomial about 105 * (Degree + 2) times, so the compiler's
+		// constant evaluation budget bounds the degree and the cost of f -- see the README for step counts.
+		// the exchange stops when the error levels out, or after max_iterations steps.
+		template <std::size_t Degree, typename Function>
+		consteval std::array<double, Degree + 1> remez(Function f, double lo, double hi, int max_iterations = 12)
+		{
+			if (!(lo < hi))
+			{
+				throw std::domain_error("remez interval must have lo < hi");
+			}
+
+			constexpr std::size_t reference_count = Degree + 2;
+			constexpr double pi = 3.141592653589793238462643383279502884;
+
+			// start from the chebyshev extrema
+			std::array<double, reference_count> reference{};
+			for (std::size_t i = 0; i < reference_count; ++i)
+			{
+				const double node = detail::remez_cos(pi * static_cast<double>(reference_count - 1 - i) / static_cast<double>(reference_count - 1));
+				reference[i] = (lo + hi) / 2 + (hi - lo) / 2 * node;
+			}
+			reference[0] = lo;
+			reference[reference_count - 1] = hi;
+
+			auto coefficients = detail::remez_solve<Degree>(reference, f);
+
+			for (int iteration = 0; iteration < max_iterations; ++iteration)
+			{
+				// the error alternates in sign at the reference points, so it has a zero between each of them
+				std::array<double, reference_count + 1> bounds{};
+				bounds[0] = lo;
+				bounds[reference_count] = hi;
+				for (std::size_t i = 1; i < reference_count; ++i)
+					bounds[i] = detail::remez_zero(coefficients, f, reference[i - 1], reference[i]);
+
+				// the new reference is where the error is largest between the zeros
+				double smallest_error = std::numeric_limits<double>::infinity();
+				double largest_error = 0.0;
+
+				for (std::size_t i = 0; i < reference_count; ++i)
+				{
+					double extremum = detail::remez_extremum(coefficients, f, bounds[i], bounds[i + 1]);
+					double extremum_error = relaxed::abs(detail::remez_error(coefficients, f, extremum));
+
+					// the interval end points are usually extrema, and golden section search never quite reaches them
+					for (double end_point : {bounds[i], bounds[i + 1]})
+					{
+						if (((end_point == lo) || (end_point == hi)) && (relaxed::abs(detail::remez_error(coefficients, f, end_point)) > extremum_error))
+						{
+							extremum = end_point;
+							extremum_error = relaxed::abs(detail::remez_error(coefficients, f, end_point));
+						}
+					}
+
+					reference[i] = extremum;
+					smallest_error = (extremum_error < smallest_error) ? extremum_error : smallest_error;
+					largest_error = (extremum_error > largest_error) ? extremum_error : largest_error;
+				}
+
+				// levelled to within a part in a thousand is as good as the rounded coefficients can do
+				if (largest_error - smallest_error <= largest_error / 1024)
+					break;
+
+				coefficients = detail::remez_solve<Degree>(reference, f);
+			}
+
+			return coefficients;
+		}
+
+		//
+		// make_table() - compile time lookup tables with interpolation, not in standard library
+		//
+
+		enum class interpolation
+		{
+			nearest,
+			linear,
+			cubic
+		};
+
+		// a function sampled at N evenly spaced points on [lo, hi]. inputs outside [lo, hi] are clamped to it.
+		template <cxcm::concepts::basic_floating_point T, std::size_t N>
+		struct lookup_table
+		{
+			static_assert(N >= 4, "lookup_table needs at least 4 entries for cubic interpolation");
+
+			std::array<T, N> values{};
+			T lo{};
+			T hi{};
+
+			// table positions per unit of x
+			T scale{};
+
+			// position of x in the table, clamped to [0, N - 1]
+			constexpr T position(T x) const noexcept
+			{
+				const T table_position = (x - lo) * scale;
+
+				if (table_position < T(0))
+					return T(0);
+				else if (table_position > T(N - 1))
+					return T(N - 1);
+
+				return table_position;
+			}
+
+			constexpr T nearest(T x) const noexcept
+			{
+				if (isnan(x))
+					return detail::convert_to_quiet_nan(x);
+
+				return values[static_cast<std::size_t>(cxcm::floor(position(x) + T(0.5)))];
+			}
+
+			constexpr T linear(T x) const noexcept
+			{
+				if (isnan(x))
+					return detail::convert_to_quiet_nan(x);
+
+				const T table_position = position(x);
+				T index = cxcm::floor(table_position);
+				if (index > T(N - 2))
+					index = T(N - 2);
+
+				const T t = table_position - index;
+				const std::size_t i = static_cast<std::size_t>(index);
+
+				return values[i] + t * (values[i + 1] - values[i]);
+			}
+
+			// 4 point lagrange interpolation, shifted at the ends of the table to stay inside it
+			constexpr T cubic(T x) const noexcept
+			{
+				if (isnan(x))
+					return detail::convert_to_quiet_nan(x);
+
+				const T table_position = position(x);
+				T index = cxcm::floor(table_position) - T(1);
+				if (index < T(0))
+					index = T(0);
+				else if (index > T(N - 4))
+					index = T(N - 4);
+
+				const T t = table_position - index;
+				const std::size_t i = static_cast<std::size_t>(index);
+
+				const T t1 = t - T(1);
+				const T t2 = t - T(2);
+				const T t3 = t - T(3);
+
+				return (values[i + 3] * t * t1 * t2 - values[i] * t1 * t2 * t3) / T(6) +
+					   (values[i + 1] * t * t2 * t3 - values[i + 2] * t * t1 * t3) / T(2);
+			}
+
+			constexpr T operator ()(T x, interpolation method = interpolation::linear) const noexcept
+			{
+				switch (method)
+				{
+					case interpolation::nearest:
+						return nearest(x);
+
+					case interpolation::cubic:
+						return cubic(x);
+
+					default:
+						return linear(x);
+				}
+			}
+
+			// largest absolute error from f, sampled at sample_count evenly spaced points on [lo, hi]
+			template <typename Function>
+			constexpr T max_error(Function f, interpolation method, std::size_t sample_count = 65536) const
+			{
+				T largest_error = T(0);
+
+				for (std::size_t i = 0; i < sample_count; ++i)
+				{
+					const T x = lo + (hi - lo) * (static_cast<T>(i) / static_cast<T>(sample_count - 1));
+					const T error = relaxed::abs((*this)(x, method) - static_cast<T>(f(x)));
+
+					if (error > largest_error)
+						largest_error = error;
+				}
+
+				return largest_error;
+			}
+		};
+
+		// samples f at N evenly spaced points on [lo, hi], including both end points. intended for constexpr use
+		// with cxcm functions, e.g., constexpr auto table = cxcm::make_table<256>([](double x) { return cxcm::sqrt(x); }, 1.0, 4.0);
+		template <std::size_t N, cxcm::concepts::basic_floating_point T, typename Function>
+		constexpr lookup_table<T, N> make_table(Function f, T lo, T hi)
+		{
+			if (!(lo < hi))
+			{
+				throw std::domain_error("lookup table interval must have lo < hi");
+			}
+
+			lookup_table<T, N> table;
+			table.lo = lo;
+			table.hi = hi;
+			table.scale = T(N - 1) / (hi - lo);
+
+			for (std::size_t i = 0; i < N; ++i)
+				table.values[i] = static_cast<T>(f(lo + (hi - lo) * (static_cast<T>(i) / static_cast<T>(N - 1))));
+
+			return table;
+		}
+
+		//
+		// periodic - wrapping values into a half-open interval [lo, hi), not in standard library
+		//
+
+		namespace detail
+		{
+			template <typename T>
+			concept periodic_floating_point = std::same_as<T, float> || std::same_as<T, double>;
+
+			// the double-double remainder is only trusted for quotients below this. further away, both values are first
+			// brought within a period of zero with an exact fmod.
+			inline constexpr double periodic_quotient_limit = 0x1.0p40;
+		}
+
+		// values are equivalent when they differ by a whole number of periods, hi - lo. the work is done in double-double
+		// with a precomputed reciprocal, without any division, and a value a whole number of periods from lo is exactly lo.
+		template <detail::periodic_floating_point T>
+		struct periodic
+		{
+			T lo{};
+			T hi{};
+			T period{};
+
+			// 1 / period
+			dd_real::dd_real reciprocal{};
+
+			constexpr bool contains(T x) const noexcept
+			{
+				return (lo <= x) && (x < hi);
+			}
+
+			// x - base, less a whole number of periods, in [0, period), or in [-period / 2, period / 2) if centered.
+			// both values must be finite.
+			constexpr dd_real::dd_real reduce(T x, T base, bool centered) const noexcept
+			{
+				const double length = static_cast<double>(period);
+
+				double error = 0.0;
+				double difference = dd_real::two_sum(static_cast<double>(x), -static_cast<double>(base), error);
+
+				if (!(relaxed::abs(difference) < length * detail::periodic_quotient_limit))
+					difference = dd_real::two_sum(static_cast<double>(cxcm::fmod(x, period)), -static_cast<double>(cxcm::fmod(base, period)), error);
+
+				const dd_real::dd_real d(difference, error);
+				const double quotient = cxcm::floor((d * reciprocal)[0] + (centered ? 0.5 : 0.0));
+
+				double product_error = 0.0;
+				const double product = dd_real::two_prod(quotient, length, product_error);
+
+				// the quotient can be off by one either way
+				dd_real::dd_real r = d - dd_real::dd_real(product, product_error);
+				const double low = centered ? -0.5 * length : 0.0;
+				const double high = centered ? 0.5 * length : length;
+
+				if ((r[0] < low) || ((r[0] == low) && (r[1] < 0)))
+					r = r + length;
+				else if ((r[0] > high) || ((r[0] == high) && (r[1] >= 0)))
+					r = r + -length;
+
+				return r;
+			}
+
+			// the equivalent value in [lo, hi). anything that would round up to hi is lo.
+			constexpr T wrap(T x) const noexcept
+			{
+				if (!isfinite(x))
+					return std::numeric_limits<T>::quiet_NaN();
+
+				const T result = static_cast<T>((reduce(x, lo, false) + static_cast<double>(lo))[0]);
+
+				return ((result < hi) && (result != lo)) ? result : lo;
+			}
+
+			// the signed shortest way around from one value to another, in [-period / 2, period / 2)
+			constexpr T distance(T from, T to) const noexcept
+			{
+				if (!isfinite(from) || !isfinite(to))
+					return std::numeric_limits<T>::quiet_NaN();
+
+				const T half = period / 2;
+				const T result = static_cast<T>(reduce(to, from, true)[0]);
+
+				return ((result < half) ? result : -half) + T(0);
+			}
+
+			// the value equivalent to x that is closest to reference, e.g., for unwrapping a sequence of angles
+			constexpr T nearest_representative(T x, T reference) const noexcept
+			{
+				if (!isfinite(x) || !isfinite(reference))
+					return std::numeric_limits<T>::quiet_NaN();
+
+				const T result = static_cast<T>((reduce(x, reference, true) + static_cast<double>(reference))[0]);
+
+				return (result != reference) ? result : reference;
+			}
+		};
+
+		// the interval [lo, hi). hi - lo must be exactly representable, as it is for [0, 360), [-pi, pi), or a day in seconds.
+		template <detail::periodic_floating_point T>
+		constexpr periodic<T> make_periodic(T lo, T hi)
+		{
+			if (!isfinite(lo) || !isfinite(hi) || !(lo < hi))
+			{
+				throw std::domain_error("periodic interval must be finite with lo < hi");
+			}
+
+			double error = 0.0;
+			const double length = dd_real::two_sum(static_cast<double>(hi), -static_cast<double>(lo), error);
+
+			if ((error != 0) || (static_cast<double>(static_cast<T>(length)) != length) || !isfinite(static_cast<T>(length)))
+			{
+				throw std::domain_error("periodic interval length hi - lo must be exactly representable");
+			}
+
+			periodic<T> interval;
+			interval.lo = lo;
+			interval.hi = hi;
+			interval.period = static_cast<T>(length);
+			interval.reciprocal = 1.0 / dd_real::dd_real(length);
+
+			return interval;
+		}
+
+		//
+		// make_half_table() - exhaustive tables for 16-bit floating-point inputs, not in standard library
+		//
+
+		// f evaluated at every one of the 65536 values of a 16-bit floating-point type, so evaluation is a single load
+		template <cxcm::concepts::half_floating_point Half, typename Result>
+		struct half_table
+		{
+			std::array<Result, 65536> values{};
+
+			constexpr Result operator ()(Half x) const noexcept
+			{
+				return values[x.bits];
+			}
+		};
+
+		// builds the table from any function taking a float, e.g., a lambda calling cxcm functions. each entry costs
+		// a conversion plus a call to f against the constant evaluation budget, so expensive functions at compile
+		// time may need -fconstexpr-ops-limit (gcc) or -fconstexpr-steps (clang) raised.
+		template <cxcm::concepts::half_floating_point Half, typename Function>
+		constexpr auto make_half_table(Function f)
+		{
+			half_table<Half, std::invoke_result_t<Function, float>> table;
+
+			for (std::size_t i = 0; i < table.values.size(); ++i)
+				table.values[i] = f(static_cast<float>(Half::from_bits(static_cast<std::uint16_t>(i))));
+
+			return table;
+		}
+
+		//
+		// 16-bit floating-point versions
+		//
+
+		// evaluated in float, which holds every 16-bit value exactly, then rounded back once. the results are
+		// exact, or a correctly rounded square root since float has enough extra bits that the second rounding
+		// cannot go wrong. rsqrt() adds one rounding to the float result.
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T abs(T value) noexcept
+		{
+			return T::from_bits(static_cast<std::uint16_t>(value.bits & ~T::sign_mask));
+		}
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T fabs(T value) noexcept
+		{
+			return cxcm::abs(value);
+		}
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T trunc(T value) noexcept
+		{
+			return T(cxcm::trunc(static_cast<float>(value)));
+		}
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T floor(T value) noexcept
+		{
+			return T(cxcm::floor(static_cast<float>(value)));
+		}
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T ceil(T value) noexcept
+		{
+			return T(cxcm::ceil(static_cast<float>(value)));
+		}
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T round(T value) noexcept
+		{
+			return T(cxcm::round(static_cast<float>(value)));
+		}
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T round_even(T value) noexcept
+		{
+			return T(cxcm::round_even(static_cast<float>(value)));
+		}
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T fract(T value) noexcept
+		{
+			return T(cxcm::fract(static_cast<float>(value)));
+		}
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T sqrt(T value) noexcept
+		{
+			return T(cxcm::sqrt(static_cast<float>(value)));
+		}
+
+		template <cxcm::concepts::half_floating_point T>
+		constexpr T rsqrt(T value) noexcept
+		{
+			return T(cxcm::rsqrt(static_cast<float>(value)));
+		}
+
+		//
+		// binary128 versions
+		//
+
+		namespace detail
+		{
+			enum class quad_rounding { toward_zero, downward, upward, to_nearest_away };
+
+			// clears the fraction bits, first adding to the magnitude when rounding away from zero
+			template <cxcm::concepts::quad_floating_point T>
+			constexpr T quad_integral(T value, quad_rounding mode) noexcept
+			{
+				const auto bits = bitwise::to_quad_bits(value);
+				const bool negative = (bits.high & bitwise::quad_sign_mask) != 0;
+				const int exponent = static_cast<int>((bits.high & bitwise::quad_exponent_mask) >> 48) - bitwise::quad_exponent_bias;
+
+				// already integral, or infinity or NaN
+				if (exponent >= 112)
+					return value;
+
+				const bitwise::uint128 sign{bits.high & bitwise::quad_sign_mask, 0};
+				const bitwise::uint128 magnitude{bits.high & ~bitwise::quad_sign_mask, bits.low};
+
+				// |value| < 1
+				if (exponent < 0)
+				{
+					if (magnitude == bitwise::uint128{})
+						return value;
+
+					const T zero = bitwise::from_quad_bits<T>(sign);
+					const T one = negative ? static_cast<T>(-1) : static_cast<T>(1);
+
+					switch (mode)
+					{
+						case quad_rounding::downward:
+							return negative ? one : zero;
+
+						case quad_rounding::upward:
+							return negative ? zero : one;
+
+						case quad_rounding::to_nearest_away:
+							return (exponent == -1) ? one : zero;
+
+						default:
+							return zero;
+					}
+				}
+
+				const int fraction_bits = 112 - exponent;
+				const bitwise::uint128 unit = bitwise::uint128{0, 1} << fraction_bits;
+				const bitwise::uint128 fraction_mask = unit - bitwise::uint128{0, 1};
+
+				if ((magnitude & fraction_mask) == bitwise::uint128{})
+					return value;
+
+				bitwise::uint128 result = magnitude;
+
+				// a carry out of the significand correctly bumps the exponent
+				if (mode == quad_rounding::to_nearest_away)
+					result = result + (bitwise::uint128{0, 1} << (fraction_bits - 1));
+				else if ((mode == quad_rounding::downward && negative) || (mode == quad_rounding::upward && !negative))
+					result = result + unit;
+
+				return bitwise::from_quad_bits<T>((result & ~fraction_mask) | sign);
+			}
+
+			// square root of significand * 2^114 rounded to 113 bits, for a significand in [2^112, 2^114). digit by
+			// digit with one extra bit for rounding. after i steps the root has i bits and the remainder at most
+			// i + 1, so the first 61 steps fit in 64 bits and the rest in 128 bits.
+			constexpr bitwise::uint128 quad_sqrt_digits(const bitwise::uint128 &significand) noexcept
+			{
+				// only the top 57 pairs of radicand bits are nonzero
+				std::uint64_t small_root = 0;
+				std::uint64_t small_remainder = 0;
+				for (int i = 0; i < 61; ++i)
+				{
+					const std::uint64_t pair = (i < 57) ? ((significand >> (112 - 2 * i)).low & 3) : 0;
+					small_remainder = (small_remainder << 2) | pair;
+
+					const std::uint64_t trial = (small_root << 2) | 1;
+					const std::uint64_t fits = (small_remainder >= trial) ? 1 : 0;
+					small_remainder -= trial & (0 - fits);
+					small_root = (small_root << 1) | fits;
+				}
+
+				bitwise::uint128 root{0, small_root};
+				bitwise::uint128 remainder{0, small_remainder};
+				for (int i = 61; i < 114; ++i)
+				{
+					remainder = remainder << 2;
+
+					const bitwise::uint128 trial = (root << 2) | 1;
+					const std::uint64_t fits = (remainder >= trial) ? 1 : 0;
+					remainder = remainder - (trial & bitwise::uint128{0 - fits, 0 - fits});
+					root = (root << 1) | fits;
+				}
+
+				// an exact square root is never halfway between two values, so the extra bit decides rounding
+				return (root >> 1) + bitwise::uint128{0, root.low & 1};
+			}
+
+			// moves an approximate 113-bit root of significand * 2^114 to the correctly rounded one. the right
+			// root r is the only one with (2r - 1)^2 < radicand < (2r + 1)^2, and equality can't happen.
+			constexpr bitwise::uint128 quad_sqrt_correct(const bitwise::uint128 &significand, bitwise::uint128 root) noexcept
+			{
+				const bitwise::uint256 radicand{significand >> 14, significand << 114};
+				const bitwise::uint128 one{0, 1};
+
+				while (bitwise::square((root << 1) + one) < radicand)
+					root = root + one;
+
+				while (radicand < bitwise::square((root << 1) - one))
+					root = root - one;
+
+				return root;
+			}
+
+			// correctly rounded. libquadmath's sqrtq() is fast but sometimes an ulp off, so when it is used its
+			// result is corrected with exact integer arithmetic.
+			template <cxcm::concepts::quad_floating_point T>
+			constexpr T quad_sqrt(T value) noexcept
+			{
+				const auto bits = bitwise::to_quad_bits(value);
+				const bool negative = (bits.high & bitwise::quad_sign_mask) != 0;
+				int biased_exponent = static_cast<int>((bits.high & bitwise::quad_exponent_mask) >> 48);
+				bitwise::uint128 significand{bits.high & bitwise::quad_significand_mask, bits.low};
+
+				// NaN, or +infinity
+				if ((biased_exponent == 0x7FFF) && ((significand != bitwise::uint128{}) || !negative))
+					return value + value;
+
+				// +0 or -0
+				if ((biased_exponent == 0) && (significand == bitwise::uint128{}))
+					return value;
+
+				// -NaN, as for the other types
+				if (negative)
+					return bitwise::from_quad_bits<T>(bitwise::uint128{0xFFFF800000000000, 0});
+
+				// value = significand * 2^exponent, with the significand normalized to [2^112, 2^113)
+				int exponent = biased_exponent - bitwise::quad_exponent_bias - 112;
+				if (biased_exponent == 0)
+				{
+					exponent = 1 - bitwise::quad_exponent_bias - 112;
+					while ((significand.high & 0x0001000000000000) == 0)
+					{
+						significand = significand << 1;
+						--exponent;
+					}
+				}
+				else
+				{
+					significand.high |= 0x0001000000000000;
+				}
+
+				// even exponent, so the root of 2^exponent is exact
+				if (exponent & 1)
+				{
+					significand = significand << 1;
+					--exponent;
+				}
+
+				const int result_exponent = exponent / 2 - 56 + bitwise::quad_exponent_bias + 112;
+				bitwise::uint128 root{};
+				bool have_root = false;
+
+#if defined(CXCM_USE_QUADMATH)
+				if constexpr (std::is_same_v<T, __float128>)
+				{
+					if (!std::is_constant_evaluated())
+					{
+						const auto approximate = bitwise::to_quad_bits(::sqrtq(value));
+						if (static_cast<int>(approximate.high >> 48) == result_exponent)
+						{
+							root = quad_sqrt_correct(significand, bitwise::uint128{(approximate.high & bitwise::quad_significand_mask) | 0x0001000000000000, approximate.low});
+							have_root = true;
+						}
+					}
+				}
+#endif
+
+				if (!have_root)
+					root = quad_sqrt_digits(significand);
+
+				// adding the root, including its leading bit, to the exponent field one below its value carries
+				// correctly if rounding reached 2^113
+				return bitwise::from_quad_bits<T>((bitwise::uint128{0, static_cast<std::uint64_t>(result_exponent - 1)} << 112) + root);
+			}
+
+		}	// namespace detail
+
+		// with CXCM_USE_QUADMATH, the runtime versions call libquadmath for __float128
+
+		template <cxcm::concepts::quad_floating_point T>
+		constexpr T abs(T value) noexcept
+		{
+			auto bits = bitwise::to_quad_bits(value);
+			bits.high &= ~bitwise::quad_sign_mask;
+
+			return bitwise::from_quad_bits<T>(bits);
+		}
+
+		template <cxcm::concepts::quad_floating_point T>
+		constexpr T fabs(T value) noexcept
+		{
+			return cxcm::abs(value);
+		}
+
+		template <cxcm::concepts::quad_floating_point T>
+		constexpr T trunc(T value) noexcept
+		{
+#if defined(CXCM_USE_QUADMATH)
+			if constexpr (std::is_same_v<T, __float128>)
+				if (!std::is_constant_evaluated())
+					return ::truncq(value);
+#endif
+
+			return detail::quad_integral(value, detail::quad_rounding::toward_zero);
+		}
+
+		template <cxcm::concepts::quad_floating_point T>
+		constexpr T floor(T value) noexcept
+		{
+#if defined(CXCM_USE_QUADMATH)
+			if constexpr (std::is_same_v<T, __float128>)
+				if (!std::is_constant_evaluated())
+					return ::floorq(value);
+#endif
+
+			return detail::quad_integral(value, detail::quad_rounding::downward);
+		}
+
+		template <cxcm::concepts::quad_floating_point T>
+		constexpr T ceil(T value) noexcept
+		{
+#if defined(CXCM_USE_QUADMATH)
+			if constexpr (std::is_same_v<T, __float128>)
+				if (!std::is_constant_evaluated())
+					return ::ceilq(value);
+#endif
+
+			return detail::quad_integral(value, detail::quad_rounding::upward);
+		}
+
+		// rounds halfway cases away from zero
+		template <cxcm::concepts::quad_floating_point T>
+		constexpr T round(T value) noexcept
+		{
+#if defined(CXCM_USE_QUADMATH)
+			if constexpr (std::is_same_v<T, __float128>)
+				if (!std::is_constant_evaluated())
+					return ::roundq(value);
+#endif
+
+			return detail::quad_integral(value, detail::quad_rounding::to_nearest_away);
+		}
+
+		// correctly rounded
+		template <cxcm::concepts::quad_floating_point T>
+		constexpr T sqrt(T value) noexcept
+		{
+			return detail::quad_sqrt(value);
+		}
+
+		//
+		// C++23 extended floating-point versions
+		//
+
+		// the standard versions when they are constexpr, which are evaluated by the compiler much faster than the
+		// cxcm algorithms. otherwise forwarded to the float or double versions, the conversions are free.
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T abs(T value) noexcept
+		{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+			return std::abs(value);
+#else
+			return static_cast<T>(cxcm::abs(static_cast<standard_floating_point_t<T>>(value)));
+#endif
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T fabs(T value) noexcept
+		{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+			return std::fabs(value);
+#else
+			return static_cast<T>(cxcm::fabs(static_cast<standard_floating_point_t<T>>(value)));
+#endif
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T trunc(T value) noexcept
+		{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+			return std::trunc(value);
+#else
+			return static_cast<T>(cxcm::trunc(static_cast<standard_floating_point_t<T>>(value)));
+#endif
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T floor(T value) noexcept
+		{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+			return std::floor(value);
+#else
+			return static_cast<T>(cxcm::floor(static_cast<standard_floating_point_t<T>>(value)));
+#endif
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T ceil(T value) noexcept
+		{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+			return std::ceil(value);
+#else
+			return static_cast<T>(cxcm::ceil(static_cast<standard_floating_point_t<T>>(value)));
+#endif
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T round(T value) noexcept
+		{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+			return std::round(value);
+#else
+			return static_cast<T>(cxcm::round(static_cast<standard_floating_point_t<T>>(value)));
+#endif
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T fract(T value) noexcept
+		{
+			return static_cast<T>(cxcm::fract(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T fmod(T x, T y) noexcept
+		{
+#if defined(CXCM_CONSTEXPR_CMATH_23)
+			return std::fmod(x, y);
+#else
+			return static_cast<T>(cxcm::fmod(static_cast<standard_floating_point_t<T>>(x), static_cast<standard_floating_point_t<T>>(y)));
+#endif
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T round_even(T value) noexcept
+		{
+			return static_cast<T>(cxcm::round_even(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T sqrt(T value) noexcept
+		{
+#if defined(CXCM_CONSTEXPR_CMATH_26)
+			return std::sqrt(value);
+#else
+			return static_cast<T>(cxcm::sqrt(static_cast<standard_floating_point_t<T>>(value)));
+#endif
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T rsqrt(T value) noexcept
+		{
+			return static_cast<T>(cxcm::rsqrt(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+		template <cxcm::concepts::extended_floating_point T>
+		constexpr T fast_rsqrt(T value) noexcept
+		{
+			return static_cast<T>(cxcm::fast_rsqrt(static_cast<standard_floating_point_t<T>>(value)));
+		}
+
+	} // namespace strict
+
+	//
+	// policies - strict, relaxed, fast, or reproducible per call site
+	//
+
+	// cxcm::floor<cxcm::relaxed_policy>(x) is cxcm::relaxed::floor(x), resolved at compile time, so generic code can
+	// take the policy as a template parameter instead of being written once per namespace.
+
+	// the strict functions, with the standard library's results, special values included
+	struct strict_policy
+	{
+		static constexpr std::string_view name = "strict";
+	};
+
+	// the relaxed functions, which don't screen out NaN, infinity, or values too big to have a fraction
+	struct relaxed_policy
+	{
+		static constexpr std::string_view name = "relaxed";
+	};
+
+	// whatever is fastest at runtime: relaxed rounding, the hardware square root, and fast_rsqrt()
+	struct fast_policy
+	{
+		static constexpr std::string_view name = "fast";
+	};
+
+	// the bits of the constexpr algorithms at runtime too, so results don't depend on the standard library. the
+	// runtime versions use the hardware where it gives the same bits, which it does for everything but double rsqrt().
+	struct reproducible_policy
+	{
+		static constexpr std::string_view name = "reproducible";
+	};
+
+	namespace concepts
+	{
+		template <typename T>
+		concept policy = (std::is_same_v<T, strict_policy> || std::is_same_v<T, relaxed_policy> ||
+						  std::is_same_v<T, fast_policy> || std::is_same_v<T, reproducible_policy>);
+
+	}	// namespace concepts
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T abs(T value) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, relaxed_policy> || std::is_same_v<Policy, fast_policy>)
+			return relaxed::abs(value);
+		else
+			return strict::abs(value);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T fabs(T value) noexcept
+	{
+		return cxcm::abs<Policy>(value);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T trunc(T value) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, strict_policy>)
+			return strict::trunc(value);
+		else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+			return strict::detail::reproducible_trunc(value);
+		else
+			return relaxed::trunc(value);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T floor(T value) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, strict_policy>)
+			return strict::floor(value);
+		else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+			return strict::detail::reproducible_floor(value);
+		else
+			return relaxed::floor(value);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T ceil(T value) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, strict_policy>)
+			return strict::ceil(value);
+		else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+			return strict::detail::reproducible_ceil(value);
+		else
+			return relaxed::ceil(value);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T round(T value) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, strict_policy>)
+			return strict::round(value);
+		else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+			return strict::detail::reproducible_round(value);
+		else
+			return relaxed::round(value);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T round_even(T value) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, strict_policy>)
+			return strict::detail::constexpr_round_even(value);
+		else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+			return strict::detail::reproducible_round_even(value);
+		else
+			return relaxed::round_even(value);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T fract(T value) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, strict_policy>)
+			return strict::detail::constexpr_fract(value);
+		else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+			return strict::detail::reproducible_fract(value);
+		else
+			return relaxed::fract(value);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T fmod(T x, T y) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, strict_policy>)
+			return strict::fmod(x, y);
+		else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+			return strict::detail::constexpr_fmod(x, y);
+		else
+			return relaxed::fmod(x, y);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T sqrt(T value) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, strict_policy> || std::is_same_v<Policy, fast_policy>)
+			return strict::sqrt(value);
+		else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+			return strict::detail::reproducible_sqrt(value);
+		else
+			return relaxed::sqrt(value);
+	}
+
+	template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T>
+	constexpr T rsqrt(T value) noexcept
+	{
+		if constexpr (std::is_same_v<Policy, strict_policy>)
+			return strict::rsqrt(value);
+		else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+			return strict::detail::reproducible_rsqrt(value);
+		else if constexpr (std::is_same_v<Policy, fast_policy>)
+			return relaxed::fast_rsqrt(value);
+		else
+			return relaxed::rsqrt(value);
+	}
+
+	//
+	// approx<Bits> - sqrt(), rsqrt(), recip(), exp2(), log2() to a requested accuracy
+	//
+
+	// approx<12>::rsqrt(x) is within a relative 2^-12 of 1 / sqrt(x), and costs only what 12 bits need. the number
+	// of newton steps after the bit trick seed, or the degree of the series, is the smallest that the error bounds
+	// allow, worked out at compile time. log2() is within 2^-Bits relative to max(1, |log2(x)|), since it has no
+	// relative accuracy near 1. float can ask for up to 23 bits and double for up to 49: the last few bits for float
+	// are worked out in double.
+	//
+	// sqrt(), rsqrt(), and log2() expect positive normal values, recip() expects normal values under 2^125 in
+	// magnitude (2^1021 for double), where the seed is still normal, and exp2() expects values with a normal result.
+	// the results for anything else are unspecified.
+	//
+	// every multiply and add that could be contracted goes through multiply_add(), so the results are the same at
+	// compile time and at runtime. builds with fma (__FMA__) round those once and builds without round them twice,
+	// so the last bits can differ between the two.
+
+	template <int Bits>
+	struct approx
+	{
+		static_assert(Bits > 0, "approx needs at least one correct bit");
+
+		template <cxcm::concepts::basic_floating_point T>
+		static constexpr int max_bits = std::is_same_v<T, float> ? 23 : (std::is_same_v<T, double> ? 49 : 0);
+
+	private:
+		template <typename T>
+		using bits_type = std::conditional_t<(sizeof(T) == 4), std::uint32_t, std::uint64_t>;
+
+		template <typename T>
+		using working_type = std::conditional_t<(Bits > std::numeric_limits<T>::digits - 4), double, T>;
+
+		static constexpr double power_of_half(int exponent) noexcept
+		{
+			double value = 1.0;
+			for (int i = 0; i < exponent; ++i)
+				value *= 0.5;
+
+			return value;
+		}
+
+		// the target error, less a few roundings in the working type and one more when converting back to T
+		template <typename T>
+		static constexpr double error_budget(int roundings) noexcept
+		{
+			double budget = power_of_half(Bits) - roundings * power_of_half(std::numeric_limits<working_type<T>>::digits);
+			if constexpr (!std::is_same_v<working_type<T>, T>)
+				budget -= power_of_half(std::numeric_limits<T>::digits);
+
+			return budget;
+		}
+
+		// a newton step takes relative error e to e^2 * (a + b * e)
+		static constexpr int newton_steps(double seed_error, double a, double b, double budget) noexcept
+		{
+			int steps = 0;
+			for (double error = seed_error; error > budget; ++steps)
+				error = error * error * (a + b * error);
+
+			return steps;
+		}
+
+		// the largest relative errors of the seeds over every float, and a dense sample of doubles
+		static constexpr double rsqrt_seed_error = 0.0343658;
+		static constexpr double recip_seed_error = 0.0505106;
+
+		// 2^f for f in [-1/2, 1/2] is the taylor series of e^(f * ln(2)). the lagrange remainder after degree n is under
+		// r^(n + 1) / (n + 1)! * e^r with r = ln(2) / 2, and 2^f is at least e^-r.
+		static constexpr int exp2_degree_for(double budget) noexcept
+		{
+			constexpr double r = 0.34657359027997264;
+			int degree = 0;
+			for (double remainder = r * 2.0; remainder > budget; ++degree)
+				remainder *= r / (degree + 2);
+
+			return degree;
+		}
+
+		// log2(m) for m in [sqrt(1/2), sqrt(2)] is 2 / ln(2) * (t + t^3 / 3 + t^5 / 5 + ...) with t = (m - 1) / (m + 1),
+		// so |t| <= 3 - 2 * sqrt(2). the terms left after t^(2n + 1) add up to less than the next one / (1 - t^2).
+		static constexpr int log2_degree_for(double budget) noexcept
+		{
+			constexpr double t = 0.17158;
+			constexpr double two_over_ln2 = 2.8853900817779268;
+			int degree = 0;
+			double power = t * t * t;
+			while (two_over_ln2 * power / (2 * degree + 3) / (1 - t * t) > budget)
+			{
+				power *= t * t;
+				++degree;
+			}
+
+			return degree;
+		}
+
+	public:
+		template <cxcm::concepts::basic_floating_point T>
+		static constexpr int rsqrt_steps = newton_steps(rsqrt_seed_error, 1.5, 0.5, error_budget<T>(4));
+
+		template <cxcm::concepts::basic_floating_point T>
+		static constexpr int sqrt_steps = newton_steps(rsqrt_seed_error, 1.5, 0.5, error_budget<T>(5));
+
+		template <cxcm::concepts::basic_floating_point T>
+		static constexpr int recip_steps = newton_steps(recip_seed_error, 1.0, 0.0, error_budget<T>(3));
+
+		template <cxcm::concepts::basic_floating_point T>
+		static constexpr int exp2_degree = exp2_degree_for(error_budget<T>(4));
+
+		template <cxcm::concepts::basic_floating_point T>
+		static constexpr int log2_degree = log2_degree_for(error_budget<T>(4));
+
+	private:
+		template <typename W, int Degree>
+		static constexpr std::array<W, Degree + 1> exp2_coefficients = []()
+		{
+			std::array<W, Degree + 1> coefficients{};
+			double coefficient = 1.0;
+			for (int k = 0; k <= Degree; ++k)
+			{
+				coefficients[k] = static_cast<W>(coefficient);
+				coefficient *= 0.69314718055994531 / (k + 1);
+			}
+
+			return coefficients;
+		}();
+
+		template <typename W, int Degree>
+		static constexpr std::array<W, Degree + 1> log2_coefficients = []()
+		{
+			std::array<W, Degree + 1> coefficients{};
+			for (int k = 0; k <= Degree; ++k)
+				coefficients[k] = static_cast<W>(2.8853900817779268 / (2 * k + 1));
+
+			return coefficients;
+		}();
+
+		// a + b, with the last bit made odd when the sum isn't exact, so that rounding it again to fewer bits still
+		// gives the correctly rounded a + b (boldo and melquiond, emulation of fma and correctly rounded sums)
+		static constexpr double odd_sum(double a, double b) noexcept
+		{
+			double error = 0.0;
+			std::uint64_t bits = std::bit_cast<std::uint64_t>(dd_real::two_sum(a, b, error));
+			if ((error != 0.0) && ((bits & 1) == 0))
+				bits = ((error > 0.0) == (std::bit_cast<double>(bits) > 0.0)) ? bits + 1 : bits - 1;
+
+			return std::bit_cast<double>(bits);
+		}
+
+		// fma() at compile time. a float product is exact in double, and a double product is exact as two_prod().
+		template <typename W>
+		static constexpr W constexpr_fma(W a, W b, W c) noexcept
+		{
+			if constexpr (std::is_same_v<W, float>)
+			{
+				return static_cast<float>(odd_sum(static_cast<double>(a) * static_cast<double>(b), static_cast<double>(c)));
+			}
+			else
+			{
+				double product_error = 0.0;
+				const double product = dd_real::two_prod(a, b, product_error);
+				double sum_error = 0.0;
+				const double sum = dd_real::two_sum(c, product, sum_error);
+
+				return sum + odd_sum(sum_error, product_error);
+			}
+		}
+
+		// a * b + c, rounded once with fma available and twice without, the same way at compile time and at runtime.
+		// written as a * b + c, the compiler may contract it at runtime, which constant evaluation never does.
+		template <typename W>
+		static constexpr W multiply_add(W a, W b, W c) noexcept
+		{
+#if defined(__FMA__)
+			if (std::is_constant_evaluated())
+				return constexpr_fma(a, b, c);
+
+			return std::fma(a, b, c);
+#else
+			return a * b + c;
+#endif
+		}
+
+		template <typename W, std::size_t N>
+		static constexpr W horner(const std::array<W, N> &coefficients, W value) noexcept
+		{
+			W result = coefficients[N - 1];
+			for (std::size_t k = N - 1; k-- > 0;)
+				result = multiply_add(result, value, coefficients[k]);
+
+			return result;
+		}
+
+		template <typename T>
+		static constexpr working_type<T> rsqrt_newton(T value, int steps) noexcept
+		{
+			using W = working_type<T>;
+			constexpr bits_type<T> magic = std::is_same_v<T, float> ? bits_type<T>(0x5F375A86) : bits_type<T>(0x5FE6EB50C7B537A9);
+
+			const W half_value = W(0.5f) * static_cast<W>(value);
+			W estimate = static_cast<W>(std::bit_cast<T>(static_cast<bits_type<T>>(magic - (std::bit_cast<bits_type<T>>(value) >> 1))));
+			for (int i = 0; i < steps; ++i)
+				estimate *= multiply_add(-(half_value * estimate), estimate, W(1.5f));
+
+			return estimate;
+		}
+
+	public:
+		template <cxcm::concepts::basic_floating_point T>
+		requires (Bits <= max_bits<T>)
+		static constexpr T rsqrt(T value) noexcept
+		{
+			return static_cast<T>(rsqrt_newton(value, rsqrt_steps<T>));
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		requires (Bits <= max_bits<T>)
+		static constexpr T sqrt(T value) noexcept
+		{
+			return static_cast<T>(static_cast<working_type<T>>(value) * rsqrt_newton(value, sqrt_steps<T>));
+		}
+
+		// the seed works on the magnitude, and the sign goes back on after
+		template <cxcm::concepts::basic_floating_point T>
+		requires (Bits <= max_bits<T>)
+		static constexpr T recip(T value) noexcept
+		{
+			using W = working_type<T>;
+			constexpr bits_type<T> magic = std::is_same_v<T, float> ? bits_type<T>(0x7EF311C3) : bits_type<T>(0x7FDE623822FC16E6);
+			constexpr bits_type<T> sign_mask = bits_type<T>(1) << (sizeof(T) * 8 - 1);
+
+			const bits_type<T> bits = std::bit_cast<bits_type<T>>(value);
+			const bits_type<T> sign = bits & sign_mask;
+
+			const W x = static_cast<W>(value);
+			W estimate = static_cast<W>(std::bit_cast<T>(static_cast<bits_type<T>>((magic - (bits ^ sign)) | sign)));
+			for (int i = 0; i < recip_steps<T>; ++i)
+				estimate *= multiply_add(-x, estimate, W(2.0f));
+
+			return static_cast<T>(estimate);
+		}
+
+		// 2^x = 2^n * 2^f, with n the nearest integer and f = x - n exact
+		template <cxcm::concepts::basic_floating_point T>
+		requires (Bits <= max_bits<T>)
+		static constexpr T exp2(T value) noexcept
+		{
+			using W = working_type<T>;
+			constexpr int digits = std::numeric_limits<W>::digits;
+
+			// adding 1.5 * 2^(digits - 1) rounds to an integer, which ends up in the low bits
+			constexpr W shifter = static_cast<W>(3ull << (digits - 2));
+			const W shifted = static_cast<W>(value) + shifter;
+			const W nearest = shifted - shifter;
+			const auto n = static_cast<std::make_signed_t<bits_type<T>>>(std::bit_cast<bits_type<W>>(shifted) - std::bit_cast<bits_type<W>>(shifter));
+
+			const W fraction = horner(exp2_coefficients<W, exp2_degree<T>>, static_cast<W>(value) - nearest);
+
+			constexpr int t_digits = std::numeric_limits<T>::digits;
+			constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+			const T scale = std::bit_cast<T>(static_cast<bits_type<T>>(static_cast<bits_type<T>>(n + bias) << (t_digits - 1)));
+
+			return static_cast<T>(fraction) * scale;
+		}
+
+		// x = 2^e * m with m in [sqrt(1/2), sqrt(2)), straight from the bits
+		template <cxcm::concepts::basic_floating_point T>
+		requires (Bits <= max_bits<T>)
+		static constexpr T log2(T value) noexcept
+		{
+			using W = working_type<T>;
+			using signed_bits = std::make_signed_t<bits_type<T>>;
+			constexpr int digits = std::numeric_limits<T>::digits;
+			constexpr bits_type<T> sqrt_half = std::is_same_v<T, float> ? bits_type<T>(0x3F3504F3) : bits_type<T>(0x3FE6A09E667F3BCD);
+
+			const bits_type<T> bits = std::bit_cast<bits_type<T>>(value);
+			const signed_bits exponent = static_cast<signed_bits>(bits - sqrt_half) >> (digits - 1);
+			const W m = static_cast<W>(std::bit_cast<T>(static_cast<bits_type<T>>(bits - (static_cast<bits_type<T>>(exponent) << (digits - 1)))));
+
+			const W t = (m - W(1.0f)) / (m + W(1.0f));
+			const W series = horner(log2_coefficients<W, log2_degree<T>>, t * t);
+
+			return static_cast<T>(multiply_add(t, series, static_cast<W>(exponent)));
+		}
+	};
+
+	//
+	// flush_denormals_scope - FTZ and DAZ for the current thread
+	//
+
+	// sets the flush-to-zero and denormals-are-zero bits of MXCSR until the end of the scope, so sse and avx
+	// arithmetic on this thread takes subnormal input as zero and gives zero for subnormal results, without the
+	// microcode assists that make them slow. whatever the hardware computes then sees subnormals as zeros, the
+	// std:: results of the strict functions included, while constant evaluation, x87 long double, and the checks
+	// made on the bits don't, so subnormal input can give different answers on different paths. the flag of the
+	// batch functions, batch::subnormals::flush, gives the same answers everywhere. does nothing without MXCSR.
+	class flush_denormals_scope
+	{
+		public:
+			flush_denormals_scope() noexcept
+			{
+#if defined(CXCM_HAS_MXCSR)
+				previous = _mm_getcsr();
+				_mm_setcsr(previous | flush_bits);
+#endif
+			}
+
+			// only the two bits go back, so rounding mode changes and exception flags raised in the scope are kept
+			~flush_denormals_scope()
+			{
+#if defined(CXCM_HAS_MXCSR)
+				_mm_setcsr((_mm_getcsr() & ~flush_bits) | (previous & flush_bits));
+#endif
+			}
+
+			flush_denormals_scope(const flush_denormals_scope &) = delete;
+			flush_denormals_scope &operator =(const flush_denormals_scope &) = delete;
+
+			static constexpr bool supported() noexcept
+			{
+#if defined(CXCM_HAS_MXCSR)
+				return true;
+#else
+				return false;
+#endif
+			}
+
+		private:
+			// FTZ is bit 15 and DAZ is bit 6
+			static constexpr unsigned int flush_bits = 0x8040;
+			[[maybe_unused]] unsigned int previous = 0;
+	};
+
+	//
+	// batch - runtime evaluation over spans of values
+	//
+
+	// these are not constexpr. the inner loops work on fixed size blocks of values so that the compiler can
+	// vectorize them for whatever instruction set the translation unit is compiled for.
+	namespace batch
+	{
+		namespace detail
+		{
+			// number of values processed together, enough to fill a 512-bit register with floats
+			constexpr std::size_t lane_count = 16;
+
+			inline void check_sizes(std::size_t value_count, std::size_t result_count)
+			{
+				if (result_count < value_count)
+				{
+					throw std::length_error("results span is smaller than values span");
+				}
+			}
+
+		}	// namespace detail
+
+		// subnormals::flush takes subnormal values as zeros of the same sign, as the DAZ bit has the hardware do,
+		// e.g., floor(-0x1p-140f) is -0 and rsqrt(0x1p-1070) is infinity. the hardware square root slows down by an
+		// order of magnitude for subnormal input, and the flushed versions run at the speed of normal input on any
+		// tier, whatever MXCSR holds.
+		enum class subnormals
+		{
+			keep,
+			flush
+		};
+
+		namespace detail
+		{
+			// names the flushed versions for the autotuner and the path stats
+			struct flushed_subnormals
+			{
+				static constexpr std::string_view name = "flush";
+			};
+
+			template <typename T>
+			T flush_subnormal(T value) noexcept
+			{
+				return (relaxed::abs(value) < std::numeric_limits<T>::min()) ? cxcm::copysign(T(0), value) : value;
+			}
+
+		}	// namespace detail
+
+		//
+		// tier - which kernels the batch functions use
+		//
+
+		// sse4_2 is nehalem and later, avx2 adds fma and f16c (haswell), and avx512 is f, dq, bw, and vl (skylake-x)
+		enum class tier
+		{
+			scalar,
+			sse4_2,
+			avx2,
+			avx512
+		};
+
+		constexpr std::string_view tier_name(tier value) noexcept
+		{
+			switch (value)
+			{
+				case tier::sse4_2:
+					return "sse4.2";
+
+				case tier::avx2:
+					return "avx2";
+
+				case tier::avx512:
+					return "avx512";
+
+				default:
+					return "scalar";
+			}
+		}
+
+		namespace detail
+		{
+			// cpuid leaf 1 and leaf 7, with xgetbv to make sure the os saves the ymm and zmm registers
+			inline tier detect_tier() noexcept
+			{
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+				unsigned int leaf1[4] = {};
+				unsigned int leaf7[4] = {};
+				unsigned long long xcr0 = 0;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+				int registers[4] = {};
+				__cpuid(registers, 0);
+				const int max_leaf = registers[0];
+
+				__cpuidex(registers, 1, 0);
+				std::copy(registers, registers + 4, leaf1);
+
+				if (max_leaf >= 7)
+				{
+					__cpuidex(registers, 7, 0);
+					std::copy(registers, registers + 4, leaf7);
+				}
+
+				if (leaf1[2] & (1u << 27))
+					xcr0 = _xgetbv(0);
+#else
+				const unsigned int max_leaf = __get_cpuid_max(0, nullptr);
+
+				__cpuid_count(1, 0, leaf1[0], leaf1[1], leaf1[2], leaf1[3]);
+
+				if (max_leaf >= 7)
+					__cpuid_count(7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3]);
+
+				if (leaf1[2] & (1u << 27))
+				{
+					unsigned int low = 0;
+					unsigned int high = 0;
+					__asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+					xcr0 = (static_cast<unsigned long long>(high) << 32) | low;
+				}
+#endif
+
+				const bool sse4_2 = (leaf1[2] & (1u << 20)) != 0;
+				const bool fma = (leaf1[2] & (1u << 12)) != 0;
+				const bool avx = (leaf1[2] & (1u << 28)) != 0;
+				const bool f16c = (leaf1[2] & (1u << 29)) != 0;
+				const bool avx2 = (leaf7[1] & (1u << 5)) != 0;
+				const bool avx512 = (leaf7[1] & (1u << 16)) && (leaf7[1] & (1u << 17)) && (leaf7[1] & (1u << 30)) && (leaf7[1] & (1u << 31));
+
+				// xmm and ymm state, then the opmask and zmm state as well
+				const bool ymm_saved = (xcr0 & 0x06) == 0x06;
+				const bool zmm_saved = (xcr0 & 0xE6) == 0xE6;
+
+				if (sse4_2 && avx && avx2 && fma && f16c && ymm_saved)
+					return (avx512 && zmm_saved) ? tier::avx512 : tier::avx2;
+
+				return sse4_2 ? tier::sse4_2 : tier::scalar;
+#else
+				return tier::scalar;
+#endif
+			}
+
+			// CXCM_FORCE_TIER=scalar, sse4.2, avx2, or avx512 in the environment lowers the tier, e.g., to test every
+			// kernel on one machine. it never raises it past what the cpu has.
+			inline tier forced_tier(tier detected) noexcept
+			{
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+				const char *variable = std::getenv("CXCM_FORCE_TIER");
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+				if (variable == nullptr)
+					return detected;
+
+				for (tier value : {tier::scalar, tier::sse4_2, tier::avx2, tier::avx512})
+				{
+					if (tier_name(value) == variable)
+						return std::min(value, detected);
+				}
+
+				return detected;
+			}
+		}	// namespace detail
+
+		// what the cpu supports, detected once
+		inline tier detected_tier() noexcept
+		{
+			static const tier value = detail::detect_tier();
+			return value;
+		}
+
+		// what the batch functions use, detected_tier() unless CXCM_FORCE_TIER lowers it
+		inline tier active_tier() noexcept
+		{
+			static const tier value = detail::forced_tier(detected_tier());
+			return value;
+		}
+
+		namespace detail
+		{
+#if defined(CXCM_AUTOTUNE)
+			// the highest tier this thread's batch functions may use. the autotuner lowers it while it times a tier,
+			// and the tuned functions lower it to their winner.
+			inline thread_local tier tier_ceiling = tier::avx512;
+
+			class tier_ceiling_scope
+			{
+				public:
+					explicit tier_ceiling_scope(tier ceiling) noexcept : previous(tier_ceiling)
+					{
+						tier_ceiling = std::min(previous, ceiling);
+					}
+
+					~tier_ceiling_scope()
+					{
+						tier_ceiling = previous;
+					}
+
+					tier_ceiling_scope(const tier_ceiling_scope &) = delete;
+					tier_ceiling_scope &operator =(const tier_ceiling_scope &) = delete;
+
+				private:
+					tier previous;
+			};
+#endif
+
+			// the highest tier the kernels can use right now
+			inline tier ceiling_tier() noexcept
+			{
+#if defined(CXCM_AUTOTUNE)
+				return std::min(active_tier(), tier_ceiling);
+#else
+				return active_tier();
+#endif
+			}
+
+			// whether the kernels of a tier can run. kernels that weren't compiled in are never asked about.
+			inline bool tier_enabled(tier value) noexcept
+			{
+				return ceiling_tier() >= value;
+			}
+		}	// namespace detail
+
+#if defined(CXCM_AUTOTUNE)
+
+		//
+		// autotuning
+		//
+
+		// what the autotuner chose for one function and value type, e.g., "floor<float>". the timings are in
+		// nanoseconds per value for each tier from scalar up, and zero for the tiers that weren't timed, which is all
+		// of them when the choice came from the cache file.
+		struct tuning_decision
+		{
+			std::string function;
+			tier choice;
+			bool from_cache;
+			std::array<double, 4> nanoseconds_per_value;
+		};
+
+		namespace detail
+		{
+			struct tuning_state
+			{
+				std::mutex mutex;
+				std::vector<tuning_decision> decisions;
+				std::vector<std::pair<std::string, tier>> cached;
+				bool loaded = false;
+			};
+
+			inline tuning_state &tuning() noexcept
+			{
+				static tuning_state state;
+				return state;
+			}
+
+			// CXCM_AUTOTUNE_FILE in the environment, otherwise cxcm_autotune.txt in the working directory
+			inline std::string tuning_path()
+			{
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+				const char *variable = std::getenv("CXCM_AUTOTUNE_FILE");
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+				return (variable != nullptr) ? std::string(variable) : std::string("cxcm_autotune.txt");
+			}
+
+			// the first line names the detected tier, so a file from another machine is ignored
+			inline void load_tuning_cache(tuning_state &state)
+			{
+				state.loaded = true;
+
+				std::ifstream file(tuning_path());
+				std::string word;
+				if (!(file >> word >> word) || (word != tier_name(detected_tier())))
+					return;
+
+				std::string function;
+				while (file >> function >> word)
+				{
+					for (tier value : {tier::scalar, tier::sse4_2, tier::avx2, tier::avx512})
+					{
+						if (tier_name(value) == word)
+							state.cached.emplace_back(function, value);
+					}
+				}
+			}
+
+			inline void save_tuning_cache(const tuning_state &state)
+			{
+				std::ofstream file(tuning_path());
+				file << "detected " << tier_name(detected_tier()) << "\n";
+
+				for (const auto &[function, choice] : state.cached)
+					file << function << " " << tier_name(choice) << "\n";
+			}
+
+			template <typename Run>
+			double time_tier(tier candidate, std::size_t value_count, Run &run)
+			{
+				const tier_ceiling_scope ceiling(candidate);
+				run();
+
+				auto best = std::chrono::steady_clock::duration::max();
+				for (int repeat = 0; repeat < 5; ++repeat)
+				{
+					const auto start = std::chrono::steady_clock::now();
+					run();
+					best = std::min(best, std::chrono::steady_clock::now() - start);
+				}
+
+				return std::chrono::duration<double, std::nano>(best).count() / static_cast<double>(value_count);
+			}
+
+			// times run() at each tier up to the active one, unless the cache file already has the answer. a lower tier
+			// has to be more than 3% faster to win, so that noise doesn't move a function off its widest kernels.
+			template <typename Run>
+			tier tune(std::string function, std::size_t value_count, Run run)
+			{
+				tuning_state &state = tuning();
+				const std::lock_guard lock(state.mutex);
+
+				if (!state.loaded)
+					load_tuning_cache(state);
+
+				for (const auto &[cached_function, cached_choice] : state.cached)
+				{
+					if (cached_function == function)
+					{
+						const tier choice = std::min(cached_choice, active_tier());
+						state.decisions.push_back({function, choice, true, {}});
+						return choice;
+					}
+				}
+
+				tuning_decision decision{function, active_tier(), false, {}};
+				decision.nanoseconds_per_value[static_cast<std::size_t>(decision.choice)] = time_tier(decision.choice, value_count, run);
+
+				for (tier candidate = decision.choice; candidate != tier::scalar; )
+				{
+					candidate = static_cast<tier>(static_cast<int>(candidate) - 1);
+
+					const double nanoseconds = time_tier(candidate, value_count, run);
+					decision.nanoseconds_per_value[static_cast<std::size_t>(candidate)] = nanoseconds;
+
+					if (nanoseconds < 0.97 * decision.nanoseconds_per_value[static_cast<std::size_t>(decision.choice)])
+						decision.choice = candidate;
+				}
+
+				state.decisions.push_back(decision);
+				state.cached.emplace_back(function, decision.choice);
+				save_tuning_cache(state);
+
+				return decision.choice;
+			}
+
+			// a sample of values, some negative, most with fractions
+			template <typename T, typename R, typename Run>
+			tier tune_on_sample(std::string key, Run &run)
+			{
+				constexpr std::size_t sample_count = 4096;
+
+				std::vector<T> sample(sample_count);
+				for (std::size_t i = 0; i < sample_count; ++i)
+					sample[i] = static_cast<T>(static_cast<int>(i * 2654435761u % 8191) - 1000) * T(0.37f);
+
+				std::unique_ptr<R[]> sample_results(new R[sample_count]());
+
+				return tune(std::move(key), sample_count, [&] { run(std::span<const T>(sample), std::span<R>(sample_results.get(), sample_count)); });
+			}
+		}	// namespace detail
+
+		// the choices made so far, in the order the functions were first used
+		inline std::vector<tuning_decision> tuning_decisions()
+		{
+			detail::tuning_state &state = detail::tuning();
+			const std::lock_guard lock(state.mutex);
+			return state.decisions;
+		}
+
+		// the tier a tuned function uses, e.g., tuned_tier("round<double>"), or active_tier() if it hasn't run yet
+		inline tier tuned_tier(std::string_view function)
+		{
+			for (const tuning_decision &decision : tuning_decisions())
+			{
+				if (decision.function == function)
+					return decision.choice;
+			}
+
+			return active_tier();
+		}
+
+		// where the choices are kept between runs
+		inline std::string tuning_cache_path()
+		{
+			return detail::tuning_path();
+		}
+
+#endif
+
+		namespace detail
+		{
+#if defined(CXCM_AUTOTUNE) || defined(CXCM_ENABLE_PATH_STATS)
+			template <typename T>
+			std::string tuning_type_name()
+			{
+				if constexpr (std::is_same_v<T, float>)
+					return "float";
+				else if constexpr (std::is_same_v<T, double>)
+					return "double";
+				else if constexpr (std::is_same_v<T, long double>)
+					return "long double";
+				else if constexpr (std::is_same_v<T, bool>)
+					return "bool";
+				else if constexpr (cxcm::concepts::policy<T> || std::is_same_v<T, flushed_subnormals>)
+					return std::string(T::name);
+				else
+					return (std::is_signed_v<T> ? "int" : "uint") + std::to_string(8 * sizeof(T)) + "_t";
+			}
+
+			template <typename... Types>
+			std::string tuning_key(std::string_view function)
+			{
+				std::string key(function);
+				const char *separator = "<";
+				((key += separator, key += tuning_type_name<Types>(), separator = ","), ...);
+				return key + ">";
+			}
+#endif
+
+#if defined(CXCM_ENABLE_PATH_STATS)
+			// while a batch function runs, including the autotuner's timing, its scalar tails aren't counted
+			class batch_path_scope
+			{
+				public:
+					batch_path_scope() noexcept : previous(stats::detail::in_batch)
+					{
+						stats::detail::in_batch = true;
+					}
+
+					~batch_path_scope()
+					{
+						stats::detail::in_batch = previous;
+					}
+
+					batch_path_scope(const batch_path_scope &) = delete;
+					batch_path_scope &operator =(const batch_path_scope &) = delete;
+
+				private:
+					bool previous;
+			};
+
+			inline std::array<std::size_t, 4> batch_path_sites(const std::string &function)
+			{
+				return {stats::detail::path_site(function, "batch scalar"), stats::detail::path_site(function, "batch sse4.2"),
+						stats::detail::path_site(function, "batch avx2"), stats::detail::path_site(function, "batch avx512")};
+			}
+
+			// the values go under the tier the kernels can use
+			inline void count_batch_path(const std::array<std::size_t, 4> &sites, std::size_t values) noexcept
+			{
+				stats::detail::count_path_site(sites[static_cast<std::size_t>(ceiling_tier())], values);
+			}
+#endif
+
+			// runs a batch function's kernels, at the tier the autotuner picked for this function and these types when
+			// it is on. Types name the function for the cache file.
+			template <typename... Types, typename T, typename R, typename Run>
+			void run_tuned([[maybe_unused]] std::string_view function, std::span<const T> values, std::span<R> results, Run run)
+			{
+#if defined(CXCM_ENABLE_PATH_STATS)
+				// Run is a different lambda for each batch function, so each gets its own sites
+				static const std::array<std::size_t, 4> sites = batch_path_sites(tuning_key<Types...>(function));
+				const batch_path_scope in_batch;
+#endif
+#if defined(CXCM_AUTOTUNE)
+				if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+				{
+					static const tier tuned = tune_on_sample<T, R>(tuning_key<Types...>(function), run);
+					const tier_ceiling_scope ceiling(tuned);
+#if defined(CXCM_ENABLE_PATH_STATS)
+					count_batch_path(sites, values.size());
+#endif
+					run(values, results);
+					return;
+				}
+#endif
+#if defined(CXCM_ENABLE_PATH_STATS)
+				count_batch_path(sites, values.size());
+#endif
+				run(values, results);
+			}
+		}	// namespace detail
+
+		//
+		// horner(), estrin(), comp_horner()
+		//
+
+		// evaluate one polynomial at every value
+
+		template <cxcm::concepts::basic_floating_point T, std::size_t N>
+		void horner(const std::array<T, N> &coefficients, std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			const std::size_t count = values.size();
+			std::size_t i = 0;
+
+			if constexpr (N > 0)
+			{
+				for (; i + detail::lane_count <= count; i += detail::lane_count)
+				{
+					T lanes[detail::lane_count];
+
+					for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+						lanes[lane] = coefficients[N - 1];
+
+					for (std::size_t j = N - 1; j-- > 0;)
+					{
+						for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+							lanes[lane] = lanes[lane] * values[i + lane] + coefficients[j];
+					}
+
+					for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+						results[i + lane] = lanes[lane];
+				}
+			}
+
+			for (; i < count; ++i)
+				results[i] = cxcm::horner(coefficients, values[i]);
+		}
+
+		template <cxcm::concepts::basic_floating_point T, std::size_t N>
+		void estrin(const std::array<T, N> &coefficients, std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			const std::size_t count = values.size();
+			std::size_t i = 0;
+
+			// the same pairs combined in the same order as the scalar version, a block of values at a time
+			if constexpr (N > 1)
+			{
+				for (; i + detail::lane_count <= count; i += detail::lane_count)
+				{
+					T terms[N][detail::lane_count];
+					T powers[detail::lane_count];
+
+					for (std::size_t j = 0; j < N; ++j)
+					{
+						for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+							terms[j][lane] = coefficients[j];
+					}
+
+					for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+						powers[lane] = values[i + lane];
+
+					std::size_t term_count = N;
+					while (term_count > 1)
+					{
+						const std::size_t pair_count = term_count / 2;
+
+						for (std::size_t j = 0; j < pair_count; ++j)
+						{
+							for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+								terms[j][lane] = terms[2 * j][lane] + terms[2 * j + 1][lane] * powers[lane];
+						}
+
+						if (term_count % 2)
+						{
+							for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+								terms[pair_count][lane] = terms[term_count - 1][lane];
+
+							term_count = pair_count + 1;
+						}
+						else
+						{
+							term_count = pair_count;
+						}
+
+						for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+							powers[lane] *= powers[lane];
+					}
+
+					for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+						results[i + lane] = terms[0][lane];
+				}
+			}
+
+			for (; i < count; ++i)
+				results[i] = cxcm::estrin(coefficients, values[i]);
+		}
+
+		template <cxcm::concepts::basic_floating_point T, std::size_t N>
+		void comp_horner(const std::array<T, N> &coefficients, std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			const std::size_t count = values.size();
+			std::size_t i = 0;
+
+			if constexpr ((N > 0) && std::is_same_v<T, double>)
+			{
+				for (; i + detail::lane_count <= count; i += detail::lane_count)
+				{
+					double lanes[detail::lane_count];
+					double corrections[detail::lane_count] = {};
+
+					for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+						lanes[lane] = coefficients[N - 1];
+
+					for (std::size_t j = N - 1; j-- > 0;)
+					{
+						for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+						{
+							double product_error = 0.0;
+							double sum_error = 0.0;
+
+							const double product = dd_real::two_prod(lanes[lane], values[i + lane], product_error);
+							lanes[lane] = dd_real::two_sum(product, coefficients[j], sum_error);
+							corrections[lane] = corrections[lane] * values[i + lane] + (product_error + sum_error);
+						}
+					}
+
+					for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+						results[i + lane] = lanes[lane] + corrections[lane];
+				}
+			}
+			else if constexpr ((N > 0) && std::is_same_v<T, float>)
+			{
+				for (; i + detail::lane_count <= count; i += detail::lane_count)
+				{
+					double lanes[detail::lane_count];
+
+					for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+						lanes[lane] = coefficients[N - 1];
+
+					for (std::size_t j = N - 1; j-- > 0;)
+					{
+						for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+							lanes[lane] = lanes[lane] * static_cast<double>(values[i + lane]) + coefficients[j];
+					}
+
+					for (std::size_t lane = 0; lane < detail::lane_count; ++lane)
+						results[i + lane] = static_cast<float>(lanes[lane]);
+				}
+			}
+
+			for (; i < count; ++i)
+				results[i] = cxcm::comp_horner(coefficients, values[i]);
+		}
+
+		//
+		// lookup()
+		//
+
+		namespace detail
+		{
+#if defined(CXCM_KERNELS_AVX2)
+CXCM_TARGET_AVX2_BEGIN
+
+			// the handful of operations the gather kernels need, for each element type
+
+			struct avx2_double
+			{
+				using vector = __m256d;
+				static constexpr std::size_t width = 4;
+
+				static vector load(const double *source) noexcept { return _mm256_loadu_pd(source); }
+				static void store(double *destination, vector v) noexcept { _mm256_storeu_pd(destination, v); }
+				static vector broadcast(double value) noexcept { return _mm256_set1_pd(value); }
+				static vector add(vector a, vector b) noexcept { return _mm256_add_pd(a, b); }
+				static vector subtract(vector a, vector b) noexcept { return _mm256_sub_pd(a, b); }
+				static vector multiply(vector a, vector b) noexcept { return _mm256_mul_pd(a, b); }
+				static vector divide(vector a, vector b) noexcept { return _mm256_div_pd(a, b); }
+				static vector min(vector a, vector b) noexcept { return _mm256_min_pd(a, b); }
+				static vector max(vector a, vector b) noexcept { return _mm256_max_pd(a, b); }
+				static vector floor(vector v) noexcept { return _mm256_floor_pd(v); }
+
+				// table[index] for non-negative integral valued index. the masked form avoids reading an uninitialized source.
+				static vector gather(const double *table, vector index) noexcept
+				{
+					return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), table, _mm256_cvttpd_epi32(index), _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+				}
+
+				// NaN inputs pass through as quiet NaNs
+				static vector keep_nan(vector result, vector input) noexcept { return _mm256_blendv_pd(result, _mm256_add_pd(input, input), _mm256_cmp_pd(input, input, _CMP_UNORD_Q)); }
+			};
+
+			struct avx2_float
+			{
+				using vector = __m256;
+				static constexpr std::size_t width = 8;
+
+				static vector load(const float *source) noexcept { return _mm256_loadu_ps(source); }
+				static void store(float *destination, vector v) noexcept { _mm256_storeu_ps(destination, v); }
+				static vector broadcast(float value) noexcept { return _mm256_set1_ps(value); }
+				static vector add(vector a, vector b) noexcept { return _mm256_add_ps(a, b); }
+				static vector subtract(vector a, vector b) noexcept { return _mm256_sub_ps(a, b); }
+				static vector multiply(vector a, vector b) noexcept { return _mm256_mul_ps(a, b); }
+				static vector divide(vector a, vector b) noexcept { return _mm256_div_ps(a, b); }
+				static vector min(vector a, vector b) noexcept { return _mm256_min_ps(a, b); }
+				static vector max(vector a, vector b) noexcept { return _mm256_max_ps(a, b); }
+				static vector floor(vector v) noexcept { return _mm256_floor_ps(v); }
+
+				static vector gather(const float *table, vector index) noexcept
+				{
+					return _mm256_mask_i32gather_ps(_mm256_setzero_ps(), table, _mm256_cvttps_epi32(index), _mm256_castsi256_ps(_mm256_set1_epi32(-1)), 4);
+				}
+
+				static vector keep_nan(vector result, vector input) noexcept { return _mm256_blendv_ps(result, _mm256_add_ps(input, input), _mm256_cmp_ps(input, input, _CMP_UNORD_Q)); }
+			};
+
+			template <typename T>
+			using avx2_ops = std::conditional_t<std::is_same_v<T, double>, avx2_double, avx2_float>;
+
+			// the same arithmetic as lookup_table, a vector at a time. returns how many values were done.
+			template <typename T, std::size_t N>
+			std::size_t lookup_avx2(const lookup_table<T, N> &table, interpolation method, const T *values, T *results, std::size_t count) noexcept
+			{
+				using ops = avx2_ops<T>;
+
+				static_assert(N <= 0x7FFFFFFF, "gather indices are 32-bit");
+
+				const auto lo = ops::broadcast(table.lo);
+				const auto scale = ops::broadcast(table.scale);
+				const auto zero = ops::broadcast(T(0));
+				const auto one = ops::broadcast(T(1));
+				const auto last = ops::broadcast(T(N - 1));
+				const T *entries = table.values.data();
+
+				std::size_t i = 0;
+				for (; i + ops::width <= count; i += ops::width)
+				{
+					const auto x = ops::load(values + i);
+					const auto table_position = ops::min(ops::max(ops::multiply(ops::subtract(x, lo), scale), zero), last);
+					auto result = zero;
+
+					if (method == interpolation::nearest)
+					{
+						result = ops::gather(entries, ops::floor(ops::add(table_position, ops::broadcast(T(0.5)))));
+					}
+					else if (method == interpolation::linear)
+					{
+						const auto index = ops::min(ops::floor(table_position), ops::broadcast(T(N - 2)));
+						const auto t = ops::subtract(table_position, index);
+						const auto y0 = ops::gather(entries, index);
+						const auto y1 = ops::gather(entries + 1, index);
+
+						result = ops::add(y0, ops::multiply(t, ops::subtract(y1, y0)));
+					}
+					else
+					{
+						const auto index = ops::min(ops::max(ops::subtract(ops::floor(table_position), one), zero), ops::broadcast(T(N - 4)));
+						const auto t = ops::subtract(table_position, index);
+						const auto t1 = ops::subtract(t, one);
+						const auto t2 = ops::subtract(t, ops::broadcast(T(2)));
+						const auto t3 = ops::subtract(t, ops::broadcast(T(3)));
+						const auto y0 = ops::gather(entries, index);
+						const auto y1 = ops::gather(entries + 1, index);
+						const auto y2 = ops::gather(entries + 2, index);
+						const auto y3 = ops::gather(entries + 3, index);
+
+						const auto outer = ops::subtract(ops::multiply(y3, ops::multiply(t, ops::multiply(t1, t2))), ops::multiply(y0, ops::multiply(t1, ops::multiply(t2, t3))));
+						const auto inner = ops::subtract(ops::multiply(y1, ops::multiply(t, ops::multiply(t2, t3))), ops::multiply(y2, ops::multiply(t, ops::multiply(t1, t3))));
+
+						result = ops::add(ops::divide(outer, ops::broadcast(T(6))), ops::divide(inner, ops::broadcast(T(2))));
+					}
+
+					ops::store(results + i, ops::keep_nan(result, x));
+				}
+
+				return i;
+			}
+
+CXCM_TARGET_END
+#endif
+		}	// namespace detail
+
+		// table(values[i], method) for every value, using gather instructions where available
+		template <cxcm::concepts::basic_floating_point T, std::size_t N>
+		void lookup(const lookup_table<T, N> &table, interpolation method, std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX2)
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			{
+				if (detail::tier_enabled(tier::avx2))
+					i = detail::lookup_avx2(table, method, values.data(), results.data(), values.size());
+			}
+#endif
+
+			for (; i < values.size(); ++i)
+				results[i] = table(values[i], method);
+		}
+
+		namespace detail
+		{
+#if defined(CXCM_KERNELS_AVX2)
+CXCM_TARGET_AVX2_BEGIN
+
+			// 32-bit gathers indexed by the zero extended 16-bit inputs. returns how many values were done.
+			template <typename Half, typename Result>
+			std::size_t lookup_half_avx2(const half_table<Half, Result> &table, const Half *values, Result *results, std::size_t count) noexcept
+			{
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<Result, float>)
+				{
+					for (; i + 8 <= count; i += 8)
+					{
+						const __m256i index = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i)));
+						_mm256_storeu_ps(results + i, _mm256_mask_i32gather_ps(_mm256_setzero_ps(), table.values.data(), index, _mm256_castsi256_ps(_mm256_set1_epi32(-1)), 4));
+					}
+				}
+				else if constexpr (std::is_same_v<Result, double>)
+				{
+					for (; i + 4 <= count; i += 4)
+					{
+						const __m128i index = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(values + i)));
+						_mm256_storeu_pd(results + i, _mm256_mask_i32gather_pd(_mm256_setzero_pd(), table.values.data(), index, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8));
+					}
+				}
+
+				return i;
+			}
+
+CXCM_TARGET_END
+#endif
+		}	// namespace detail
+
+		// table(values[i]) for every value, using gather instructions where available
+		template <cxcm::concepts::half_floating_point Half, typename Result>
+		void lookup(const half_table<Half, Result> &table, std::type_identity_t<std::span<const Half>> values, std::type_identity_t<std::span<Result>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX2)
+			if (detail::tier_enabled(tier::avx2))
+				i = detail::lookup_half_avx2(table, values.data(), results.data(), values.size());
+#endif
+
+			for (; i < values.size(); ++i)
+				results[i] = table(values[i]);
+		}
+
+		//
+		// isqrt(), icbrt(), ilog2(), ipow() - exact integer math
+		//
+
+		namespace detail
+		{
+#if defined(CXCM_KERNELS_AVX2)
+CXCM_TARGET_AVX2_BEGIN
+
+			// 32-bit square roots are exact in double, 4 at a time. stops before a block with a negative value,
+			// which the scalar version reports. returns how many values were done.
+			template <typename T>
+			std::size_t isqrt_avx2(const T *values, T *results, std::size_t count) noexcept
+			{
+				const __m256d two_32 = _mm256_set1_pd(4294967296.0);
+
+				std::size_t i = 0;
+				for (; i + 4 <= count; i += 4)
+				{
+					const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i));
+					__m256d x = _mm256_cvtepi32_pd(bits);
+
+					if constexpr (std::is_signed_v<T>)
+					{
+						if (_mm_movemask_ps(_mm_castsi128_ps(bits)) != 0)
+							break;
+					}
+					else
+					{
+						// the top bit was read as a sign
+						x = _mm256_add_pd(x, _mm256_and_pd(_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LT_OQ), two_32));
+					}
+
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(results + i), _mm256_cvttpd_epi32(_mm256_sqrt_pd(x)));
+				}
+
+				return i;
+			}
+
+CXCM_TARGET_END
+#endif
+		}	// namespace detail
+
+		template <cxcm::detail::integer_root_type T>
+		void isqrt(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX2)
+			if constexpr (sizeof(T) == 4)
+			{
+				if (detail::tier_enabled(tier::avx2))
+					i = detail::isqrt_avx2(values.data(), results.data(), values.size());
+			}
+#endif
+
+			for (; i < values.size(); ++i)
+				results[i] = cxcm::isqrt(values[i]);
+		}
+
+		template <cxcm::detail::integer_root_type T>
+		void icbrt(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			for (std::size_t i = 0; i < values.size(); ++i)
+				results[i] = cxcm::icbrt(values[i]);
+		}
+
+		template <cxcm::detail::integer_math_type T>
+		void ilog2(std::type_identity_t<std::span<const T>> values, std::span<int> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			// branch free, so the compiler can vectorize it
+			for (std::size_t i = 0; i < values.size(); ++i)
+				results[i] = std::bit_width(static_cast<std::make_unsigned_t<T>>((values[i] < 0) ? T(0) : values[i])) - 1;
+		}
+
+		// the same exponent for every value
+		template <cxcm::detail::integer_root_type T>
+		void ipow(std::type_identity_t<std::span<const T>> values, unsigned int exponent, std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			for (std::size_t i = 0; i < values.size(); ++i)
+				results[i] = cxcm::ipow(values[i], exponent);
+		}
+
+		//
+		// ifloor(), iceil(), itrunc() - rounding to an integral type
+		//
+
+		namespace detail
+		{
+			// the conversion instructions give the most negative value for anything out of range and NaN, so that
+			// is the low side saturated, and the other two are fixed up. each returns how many values were done.
+
+#if defined(CXCM_KERNELS_SSE4) || defined(CXCM_KERNELS_AVX2) || defined(CXCM_KERNELS_AVX512)
+
+			// the immediate for _mm*_round_*() and _mm512_roundscale_*(). a variable rather than a function, since
+			// unoptimized builds need a constant expression there.
+			template <cxcm::detail::integer_rounding Rounding>
+			constexpr int rounding_mode =
+				(Rounding == cxcm::detail::integer_rounding::floor) ? (_MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC) :
+				(Rounding == cxcm::detail::integer_rounding::ceil) ? (_MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC) :
+				(Rounding == cxcm::detail::integer_rounding::to_even) ? (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) :
+				(_MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+
+#endif
+#if defined(CXCM_KERNELS_AVX512)
+CXCM_TARGET_AVX512_BEGIN
+
+			template <cxcm::detail::integer_rounding Rounding, typename I, typename T>
+			std::size_t round_to_int32_avx512(const T *values, I *results, std::size_t count) noexcept
+			{
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<T, float>)
+				{
+					const __m512 upper = _mm512_set1_ps(2147483648.0f);
+					const __m512i max_value = _mm512_set1_epi32(0x7FFFFFFF);
+
+					for (; i + 16 <= count; i += 16)
+					{
+						const __m512 x = _mm512_loadu_ps(values + i);
+						const __mmask16 ordered = _mm512_cmp_ps_mask(x, x, _CMP_ORD_Q);
+						const __m512 rounded = _mm512_mask_roundscale_ps(x, 0xFFFF, x, rounding_mode<Rounding>);
+						__m512i result = _mm512_maskz_cvttps_epi32(ordered, rounded);
+						result = _mm512_mask_mov_epi32(result, _mm512_cmp_ps_mask(rounded, upper, _CMP_GE_OQ), max_value);
+						_mm512_storeu_si512(results + i, result);
+					}
+				}
+				else
+				{
+					// INT_MAX is a double, so clamp before converting
+					const __m512d max_value = _mm512_set1_pd(2147483647.0);
+
+					for (; i + 8 <= count; i += 8)
+					{
+						const __m512d x = _mm512_loadu_pd(values + i);
+						const __mmask8 ordered = _mm512_cmp_pd_mask(x, x, _CMP_ORD_Q);
+						const __m512d rounded = _mm512_mask_roundscale_pd(x, 0xFF, x, rounding_mode<Rounding>);
+						_mm256_storeu_si256(reinterpret_cast<__m256i *>(results + i), _mm512_maskz_cvttpd_epi32(ordered, _mm512_maskz_min_pd(ordered, rounded, max_value)));
+					}
+				}
+
+				return i;
+			}
+
+CXCM_TARGET_END
+#endif
+#if defined(CXCM_KERNELS_AVX512DQ)
+CXCM_TARGET_AVX512_BEGIN
+
+			template <cxcm::detail::integer_rounding Rounding, typename I, typename T>
+			std::size_t round_to_int64_avx512(const T *values, I *results, std::size_t count) noexcept
+			{
+				const __m512d upper = _mm512_set1_pd(9223372036854775808.0);
+				const __m512i max_value = _mm512_set1_epi64(0x7FFFFFFFFFFFFFFFll);
+
+				std::size_t i = 0;
+				for (; i + 8 <= count; i += 8)
+				{
+					// float to double is exact
+					__m512d x;
+					if constexpr (std::is_same_v<T, float>)
+						x = _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(values + i));
+					else
+						x = _mm512_loadu_pd(values + i);
+
+					const __mmask8 ordered = _mm512_cmp_pd_mask(x, x, _CMP_ORD_Q);
+					const __m512d rounded = _mm512_mask_roundscale_pd(x, 0xFF, x, rounding_mode<Rounding>);
+					__m512i result = _mm512_maskz_cvttpd_epi64(ordered, rounded);
+					result = _mm512_mask_mov_epi64(result, _mm512_cmp_pd_mask(rounded, upper, _CMP_GE_OQ), max_value);
+					_mm512_storeu_si512(results + i, result);
+				}
+
+				return i;
+			}
+
+CXCM_TARGET_END
+#endif
+#if defined(CXCM_KERNELS_AVX2)
+CXCM_TARGET_AVX2_BEGIN
+
+			template <cxcm::detail::integer_rounding Rounding, typename I, typename T>
+			std::size_t round_to_int32_avx2(const T *values, I *results, std::size_t count) noexcept
+			{
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<T, float>)
+				{
+					const __m256 upper = _mm256_set1_ps(2147483648.0f);
+					const __m256i max_value = _mm256_set1_epi32(0x7FFFFFFF);
+
+					for (; i + 8 <= count; i += 8)
+					{
+						const __m256 x = _mm256_loadu_ps(values + i);
+						const __m256 rounded = _mm256_round_ps(x, rounding_mode<Rounding>);
+						__m256i result = _mm256_cvttps_epi32(rounded);
+						result = _mm256_blendv_epi8(result, max_value, _mm256_castps_si256(_mm256_cmp_ps(rounded, upper, _CMP_GE_OQ)));
+						result = _mm256_and_si256(result, _mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_ORD_Q)));
+						_mm256_storeu_si256(reinterpret_cast<__m256i *>(results + i), result);
+					}
+				}
+				else
+				{
+					const __m256d max_value = _mm256_set1_pd(2147483647.0);
+
+					for (; i + 4 <= count; i += 4)
+					{
+						const __m256d x = _mm256_loadu_pd(values + i);
+						const __m256d rounded = _mm256_and_pd(_mm256_round_pd(x, rounding_mode<Rounding>), _mm256_cmp_pd(x, x, _CMP_ORD_Q));
+						_mm_storeu_si128(reinterpret_cast<__m128i *>(results + i), _mm256_cvttpd_epi32(_mm256_min_pd(rounded, max_value)));
+					}
+				}
+
+				return i;
+			}
+
+CXCM_TARGET_END
+#endif
+#if defined(CXCM_KERNELS_SSE4)
+CXCM_TARGET_SSE4_BEGIN
+
+			template <cxcm::detail::integer_rounding Rounding, typename I, typename T>
+			std::size_t round_to_int32_sse4(const T *values, I *results, std::size_t count) noexcept
+			{
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<T, float>)
+				{
+					const __m128 upper = _mm_set1_ps(2147483648.0f);
+					const __m128i max_value = _mm_set1_epi32(0x7FFFFFFF);
+
+					for (; i + 4 <= count; i += 4)
+					{
+						const __m128 x = _mm_loadu_ps(values + i);
+						const __m128 rounded = _mm_round_ps(x, rounding_mode<Rounding>);
+						__m128i result = _mm_cvttps_epi32(rounded);
+						result = _mm_blendv_epi8(result, max_value, _mm_castps_si128(_mm_cmpge_ps(rounded, upper)));
+						result = _mm_and_si128(result, _mm_castps_si128(_mm_cmpord_ps(x, x)));
+						_mm_storeu_si128(reinterpret_cast<__m128i *>(results + i), result);
+					}
+				}
+				else
+				{
+					const __m128d max_value = _mm_set1_pd(2147483647.0);
+
+					for (; i + 2 <= count; i += 2)
+					{
+						const __m128d x = _mm_loadu_pd(values + i);
+						const __m128d rounded = _mm_and_pd(_mm_round_pd(x, rounding_mode<Rounding>), _mm_cmpord_pd(x, x));
+						_mm_storel_epi64(reinterpret_cast<__m128i *>(results + i), _mm_cvttpd_epi32(_mm_min_pd(rounded, max_value)));
+					}
+				}
+
+				return i;
+			}
+
+CXCM_TARGET_END
+#endif
+
+			template <cxcm::detail::integer_rounding Rounding, typename I, typename T>
+			void round_to_integers_kernels(std::span<const T> values, std::span<I> results)
+			{
+				check_sizes(values.size(), results.size());
+
+				std::size_t i = 0;
+
+				[[maybe_unused]] constexpr bool vector_types = std::is_signed_v<I> && (std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+				if constexpr (vector_types && (sizeof(I) == 4))
+				{
+#if defined(CXCM_KERNELS_AVX512)
+					if (detail::tier_enabled(tier::avx512))
+						i = round_to_int32_avx512<Rounding>(values.data(), results.data(), values.size());
+#endif
+#if defined(CXCM_KERNELS_AVX2)
+					if (detail::tier_enabled(tier::avx2))
+						i += round_to_int32_avx2<Rounding>(values.data() + i, results.data() + i, values.size() - i);
+#endif
+#if defined(CXCM_KERNELS_SSE4)
+					if (detail::tier_enabled(tier::sse4_2))
+						i += round_to_int32_sse4<Rounding>(values.data() + i, results.data() + i, values.size() - i);
+#endif
+				}
+				else if constexpr (vector_types && (sizeof(I) == 8))
+				{
+#if defined(CXCM_KERNELS_AVX512DQ)
+					if (detail::tier_enabled(tier::avx512))
+						i = round_to_int64_avx512<Rounding>(values.data(), results.data(), values.size());
+#endif
+				}
+
+				for (; i < values.size(); ++i)
+					results[i] = cxcm::detail::round_to_integer<I, Rounding>(values[i]);
+			}
+
+			template <cxcm::detail::integer_rounding Rounding, typename I, typename T>
+			void round_to_integers(std::span<const T> values, std::span<I> results)
+			{
+				constexpr std::string_view name = (Rounding == cxcm::detail::integer_rounding::floor) ? "ifloor" :
+												  (Rounding == cxcm::detail::integer_rounding::ceil) ? "iceil" : "itrunc";
+
+				if constexpr (std::is_signed_v<I> && ((sizeof(I) == 4) || (sizeof(I) == 8)))
+					run_tuned<I, T>(name, values, results, [](std::span<const T> v, std::span<I> r) { round_to_integers_kernels<Rounding>(v, r); });
+				else
+					round_to_integers_kernels<Rounding>(values, results);
+			}
+
+		}	// namespace detail
+
+		// the same results as the scalar versions, e.g., grid cell indices straight from coordinates. 32-bit signed
+		// results are converted a vector at a time with SSE4.2 and up, and 64-bit ones with AVX-512.
+
+		template <cxcm::detail::integer_math_type I, cxcm::concepts::basic_floating_point T>
+		void ifloor(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<I>> results)
+		{
+			detail::round_to_integers<cxcm::detail::integer_rounding::floor>(values, results);
+		}
+
+		template <cxcm::detail::integer_math_type I, cxcm::concepts::basic_floating_point T>
+		void iceil(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<I>> results)
+		{
+			detail::round_to_integers<cxcm::detail::integer_rounding::ceil>(values, results);
+		}
+
+		template <cxcm::detail::integer_math_type I, cxcm::concepts::basic_floating_point T>
+		void itrunc(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<I>> results)
+		{
+			detail::round_to_integers<cxcm::detail::integer_rounding::truncate>(values, results);
+		}
+
+		//
+		// floor(), ceil(), trunc(), round(), round_even(), fract(), sqrt(), rsqrt(), and the classification functions
+		//
+
+		namespace detail
+		{
+			enum class elementwise
+			{
+				floor,
+				ceil,
+				trunc,
+				round,
+				round_even,
+				fract,
+				sqrt
+			};
+
+			// round_even() and fract() hand back NaN unchanged with gcc, and quieted otherwise, like the scalar
+			// versions (see constexpr_fract())
+#if defined(__GNUC__) && !defined(__clang__)
+			constexpr bool screening_keeps_nan = true;
+#else
+			constexpr bool screening_keeps_nan = false;
+#endif
+
+			enum class classification
+			{
+				fpclassify,
+				isnan,
+				isinf,
+				isfinite,
+				isnormal,
+				signbit
+			};
+
+			// the kernels take the hardware square root, and relaxed::sqrt() would never finish for a NaN
+			template <elementwise Function, typename Policy, typename T>
+			T elementwise_scalar(T value) noexcept
+			{
+				if constexpr (Function == elementwise::floor)
+					return cxcm::floor<Policy>(value);
+				else if constexpr (Function == elementwise::ceil)
+					return cxcm::ceil<Policy>(value);
+				else if constexpr (Function == elementwise::trunc)
+					return cxcm::trunc<Policy>(value);
+				else if constexpr (Function == elementwise::round)
+					return cxcm::round<Policy>(value);
+				else if constexpr (Function == elementwise::round_even)
+					return cxcm::round_even<Policy>(value);
+				else if constexpr (Function == elementwise::fract)
+					return cxcm::fract<Policy>(value);
+				else if constexpr (std::is_same_v<Policy, reproducible_policy>)
+					return cxcm::sqrt<Policy>(value);
+				else
+					return cxcm::sqrt<fast_policy>(value);
+			}
+
+			// the kernels only differ in screening, and fast_policy has nothing faster than relaxed_policy to offer them
+			template <typename Policy>
+			using kernel_policy = std::conditional_t<std::is_same_v<Policy, fast_policy>, relaxed_policy, Policy>;
+
+			template <classification Function, typename T>
+			auto classification_scalar(T value) noexcept
+			{
+				if constexpr (Function == classification::fpclassify)
+					return cxcm::fpclassify(value);
+				else if constexpr (Function == classification::isnan)
+					return cxcm::isnan(value);
+				else if constexpr (Function == classification::isinf)
+					return cxcm::isinf(value);
+				else if constexpr (Function == classification::isfinite)
+					return cxcm::isfinite(value);
+				else if constexpr (Function == classification::isnormal)
+					return cxcm::isnormal(value);
+				else
+					return cxcm::signbit(value);
+			}
+
+#if defined(CXCM_KERNELS_AVX512DQ)
+CXCM_TARGET_AVX512_BEGIN
+
+			// vrndscale rounds, vfpclass picks out the values the screened functions hand back unchanged, and
+			// masked moves take the place of the branches
+
+			template <typename T>
+			struct avx512_elementwise_ops;
+
+			template <>
+			struct avx512_elementwise_ops<double>
+			{
+				using vector = __m512d;
+				using mask = __mmask8;
+				static constexpr std::size_t width = 8;
+
+				static vector load(const double *source) noexcept { return _mm512_loadu_pd(source); }
+				static void store(double *destination, vector v) noexcept { _mm512_storeu_pd(destination, v); }
+				static vector broadcast(double value) noexcept { return _mm512_set1_pd(value); }
+				static vector add(vector a, vector b) noexcept { return _mm512_add_pd(a, b); }
+				static vector subtract(vector a, vector b) noexcept { return _mm512_sub_pd(a, b); }
+				static vector sqrt(vector v) noexcept { return _mm512_maskz_sqrt_pd(0xFF, v); }
+				static vector abs(vector v) noexcept { return _mm512_abs_pd(v); }
+				static vector copy_sign(vector magnitude, vector sign) noexcept { return _mm512_castsi512_pd(_mm512_ternarylogic_epi64(_mm512_castpd_si512(magnitude), _mm512_castpd_si512(sign), _mm512_set1_epi64(std::numeric_limits<std::int64_t>::max()), 0xE4)); }
+
+				// only the sign of the lanes below the smallest normal value is kept. vfpclass would miss the subnormals
+				// when DAZ is set, where the compare sees a zero, which is below it too.
+				static vector flush_subnormals(vector v) noexcept { return _mm512_mask_and_pd(v, _mm512_cmp_pd_mask(abs(v), broadcast(std::numeric_limits<double>::min()), _CMP_LT_OQ), v, broadcast(-0.0)); }
+
+				template <int Mode>
+				static vector round(vector v) noexcept { return _mm512_mask_roundscale_pd(v, 0xFF, v, Mode); }
+
+				// zeros, infinities, values too big to have a fraction, and NaN when screening keeps it
+				static mask screened(vector v) noexcept
+				{
+					return _mm512_fpclass_pd_mask(v, screening_keeps_nan ? 0x87 : 0x06) | _mm512_cmp_pd_mask(abs(v), broadcast(limits::largest_fractional_value<double>), _CMP_GT_OQ);
+				}
+
+				static mask greater_equal(vector a, vector b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+				static vector select(mask m, vector a, vector b) noexcept { return _mm512_mask_blend_pd(m, b, a); }
+				static vector add_where(mask m, vector a, vector b) noexcept { return _mm512_mask_add_pd(a, m, a, b); }
+
+				// the fpclassify() values, held in the lanes
+				static vector classify(vector v) noexcept
+				{
+					vector codes = broadcast(FP_NORMAL);
+					codes = _mm512_mask_mov_pd(codes, _mm512_fpclass_pd_mask(v, 0x20), broadcast(FP_SUBNORMAL));
+					codes = _mm512_mask_mov_pd(codes, _mm512_fpclass_pd_mask(v, 0x06), broadcast(FP_ZERO));
+					codes = _mm512_mask_mov_pd(codes, _mm512_fpclass_pd_mask(v, 0x18), broadcast(FP_INFINITE));
+					return _mm512_mask_mov_pd(codes, _mm512_fpclass_pd_mask(v, 0x81), broadcast(FP_NAN));
+				}
+
+				static mask equal(vector a, vector b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+				static mask sign(vector v) noexcept { return _mm512_movepi64_mask(_mm512_castpd_si512(v)); }
+				static void store_ints(int *destination, vector v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), _mm512_maskz_cvtpd_epi32(0xFF, v)); }
+				static void store_bools(bool *destination, mask m) noexcept { _mm_storel_epi64(reinterpret_cast<__m128i *>(destination), _mm512_maskz_cvtepi64_epi8(0xFF, _mm512_maskz_set1_epi64(m, 1))); }
+			};
+
+			template <>
+			struct avx512_elementwise_ops<float>
+			{
+				using vector = __m512;
+				using mask = __mmask16;
+				static constexpr std::size_t width = 16;
+
+				static vector load(const float *source) noexcept { return _mm512_loadu_ps(source); }
+				static void store(float *destination, vector v) noexcept { _mm512_storeu_ps(destination, v); }
+				static vector broadcast(float value) noexcept { return _mm512_set1_ps(value); }
+				static vector add(vector a, vector b) noexcept { return _mm512_add_ps(a, b); }
+				static vector subtract(vector a, vector b) noexcept { return _mm512_sub_ps(a, b); }
+				static vector sqrt(vector v) noexcept { return _mm512_maskz_sqrt_ps(0xFFFF, v); }
+				static vector abs(vector v) noexcept { return _mm512_abs_ps(v); }
+				static vector copy_sign(vector magnitude, vector sign) noexcept { return _mm512_castsi512_ps(_mm512_ternarylogic_epi32(_mm512_castps_si512(magnitude), _mm512_castps_si512(sign), _mm512_set1_epi32(0x7FFFFFFF), 0xE4)); }
+				static vector flush_subnormals(vector v) noexcept { return _mm512_mask_and_ps(v, _mm512_cmp_ps_mask(abs(v), broadcast(std::numeric_limits<float>::min()), _CMP_LT_OQ), v, broadcast(-0.0f)); }
+
+				template <int Mode>
+				static vector round(vector v) noexcept { return _mm512_mask_roundscale_ps(v, 0xFFFF, v, Mode); }
+
+				static mask screened(vector v) noexcept
+				{
+					return _mm512_fpclass_ps_mask(v, screening_keeps_nan ? 0x87 : 0x06) | _mm512_cmp_ps_mask(abs(v), broadcast(limits::largest_fractional_value<float>), _CMP_GT_OQ);
+				}
+
+				static mask greater_equal(vector a, vector b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+				static vector select(mask m, vector a, vector b) noexcept { return _mm512_mask_blend_ps(m, b, a); }
+				static vector add_where(mask m, vector a, vector b) noexcept { return _mm512_mask_add_ps(a, m, a, b); }
+
+				static vector classify(vector v) noexcept
+				{
+					vector codes = broadcast(FP_NORMAL);
+					codes = _mm512_mask_mov_ps(codes, _mm512_fpclass_ps_mask(v, 0x20), broadcast(FP_SUBNORMAL));
+					codes = _mm512_mask_mov_ps(codes, _mm512_fpclass_ps_mask(v, 0x06), broadcast(FP_ZERO));
+					codes = _mm512_mask_mov_ps(codes, _mm512_fpclass_ps_mask(v, 0x18), broadcast(FP_INFINITE));
+					return _mm512_mask_mov_ps(codes, _mm512_fpclass_ps_mask(v, 0x81), broadcast(FP_NAN));
+				}
+
+				static mask equal(vector a, vector b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+				static mask sign(vector v) noexcept { return _mm512_movepi32_mask(_mm512_castps_si512(v)); }
+				static void store_ints(int *destination, vector v) noexcept { _mm512_storeu_si512(destination, _mm512_maskz_cvtps_epi32(0xFFFF, v)); }
+				static void store_bools(bool *destination, mask m) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm512_maskz_cvtepi32_epi8(0xFFFF, _mm512_maskz_set1_epi32(m, 1))); }
+			};
+
+CXCM_TARGET_END
+#endif
+
+#if defined(CXCM_KERNELS_AVX2)
+CXCM_TARGET_AVX2_BEGIN
+
+			// the same operations with compares and blends
+
+			template <typename T>
+			struct avx2_elementwise_ops;
+
+			template <>
+			struct avx2_elementwise_ops<double>
+			{
+				using vector = __m256d;
+				using mask = __m256d;
+				static constexpr std::size_t width = 4;
+
+				static vector load(const double *source) noexcept { return _mm256_loadu_pd(source); }
+				static void store(double *destination, vector v) noexcept { _mm256_storeu_pd(destination, v); }
+				static vector broadcast(double value) noexcept { return _mm256_set1_pd(value); }
+				static vector add(vector a, vector b) noexcept { return _mm256_add_pd(a, b); }
+				static vector subtract(vector a, vector b) noexcept { return _mm256_sub_pd(a, b); }
+				static vector sqrt(vector v) noexcept { return _mm256_sqrt_pd(v); }
+				static vector abs(vector v) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v); }
+				static vector copy_sign(vector magnitude, vector sign) noexcept { return _mm256_or_pd(abs(magnitude), _mm256_and_pd(_mm256_set1_pd(-0.0), sign)); }
+
+				// all bits are kept but the lanes below the smallest normal value, where only the sign is. zeros and NaN
+				// go through either way.
+				static vector flush_subnormals(vector v) noexcept { return _mm256_and_pd(v, _mm256_or_pd(_mm256_cmp_pd(abs(v), broadcast(std::numeric_limits<double>::min()), _CMP_NLT_UQ), _mm256_set1_pd(-0.0))); }
+
+				template <int Mode>
+				static vector round(vector v) noexcept { return _mm256_round_pd(v, Mode); }
+
+				static mask screened(vector v) noexcept
+				{
+					mask result = _mm256_or_pd(_mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_EQ_OQ), _mm256_cmp_pd(abs(v), broadcast(limits::largest_fractional_value<double>), _CMP_GT_OQ));
+					if constexpr (screening_keeps_nan)
+						result = _mm256_or_pd(result, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+
+					return result;
+				}
+
+				static mask greater_equal(vector a, vector b) noexcept { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+				static vector select(mask m, vector a, vector b) noexcept { return _mm256_blendv_pd(b, a, m); }
+				static vector add_where(mask m, vector a, vector b) noexcept { return _mm256_blendv_pd(a, _mm256_add_pd(a, b), m); }
+
+				static vector classify(vector v) noexcept
+				{
+					const vector magnitude = abs(v);
+					vector codes = broadcast(FP_NORMAL);
+					codes = select(_mm256_cmp_pd(magnitude, broadcast(std::numeric_limits<double>::min()), _CMP_LT_OQ), broadcast(FP_SUBNORMAL), codes);
+					codes = select(_mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_EQ_OQ), broadcast(FP_ZERO), codes);
+					codes = select(_mm256_cmp_pd(magnitude, broadcast(std::numeric_limits<double>::infinity()), _CMP_EQ_OQ), broadcast(FP_INFINITE), codes);
+					return select(_mm256_cmp_pd(v, v, _CMP_UNORD_Q), broadcast(FP_NAN), codes);
+				}
+
+				static mask equal(vector a, vector b) noexcept { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+				static mask sign(vector v) noexcept { return v; }		// blends and movemask only look at the sign bit
+				static void store_ints(int *destination, vector v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm256_cvtpd_epi32(v)); }
+				static void store_bools(bool *destination, mask m) noexcept
+				{
+					const int bits = _mm256_movemask_pd(m);
+					for (std::size_t j = 0; j < width; ++j)
+						destination[j] = ((bits >> j) & 1) != 0;
+				}
+			};
+
+			template <>
+			struct avx2_elementwise_ops<float>
+			{
+				using vector = __m256;
+				using mask = __m256;
+				static constexpr std::size_t width = 8;
+
+				static vector load(const float *source) noexcept { return _mm256_loadu_ps(source); }
+				static void store(float *destination, vector v) noexcept { _mm256_storeu_ps(destination, v); }
+				static vector broadcast(float value) noexcept { return _mm256_set1_ps(value); }
+				static vector add(vector a, vector b) noexcept { return _mm256_add_ps(a, b); }
+				static vector subtract(vector a, vector b) noexcept { return _mm256_sub_ps(a, b); }
+				static vector sqrt(vector v) noexcept { return _mm256_sqrt_ps(v); }
+				static vector abs(vector v) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+				static vector copy_sign(vector magnitude, vector sign) noexcept { return _mm256_or_ps(abs(magnitude), _mm256_and_ps(_mm256_set1_ps(-0.0f), sign)); }
+				static vector flush_subnormals(vector v) noexcept { return _mm256_and_ps(v, _mm256_or_ps(_mm256_cmp_ps(abs(v), broadcast(std::numeric_limits<float>::min()), _CMP_NLT_UQ), _mm256_set1_ps(-0.0f))); }
+
+				template <int Mode>
+				static vector round(vector v) noexcept { return _mm256_round_ps(v, Mode); }
+
+				static mask screened(vector v) noexcept
+				{
+					mask result = _mm256_or_ps(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_EQ_OQ), _mm256_cmp_ps(abs(v), broadcast(limits::largest_fractional_value<float>), _CMP_GT_OQ));
+					if constexpr (screening_keeps_nan)
+						result = _mm256_or_ps(result, _mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+
+					return result;
+				}
+
+				static mask greater_equal(vector a, vector b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+				static vector select(mask m, vector a, vector b) noexcept { return _mm256_blendv_ps(b, a, m); }
+				static vector add_where(mask m, vector a, vector b) noexcept { return _mm256_blendv_ps(a, _mm256_add_ps(a, b), m); }
+
+				static vector classify(vector v) noexcept
+				{
+					const vector magnitude = abs(v);
+					vector codes = broadcast(FP_NORMAL);
+					codes = select(_mm256_cmp_ps(magnitude, broadcast(std::numeric_limits<float>::min()), _CMP_LT_OQ), broadcast(FP_SUBNORMAL), codes);
+					codes = select(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_EQ_OQ), broadcast(FP_ZERO), codes);
+					codes = select(_mm256_cmp_ps(magnitude, broadcast(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ), broadcast(FP_INFINITE), codes);
+					return select(_mm256_cmp_ps(v, v, _CMP_UNORD_Q), broadcast(FP_NAN), codes);
+				}
+
+				static mask equal(vector a, vector b) noexcept { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+				static mask sign(vector v) noexcept { return v; }
+				static void store_ints(int *destination, vector v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), _mm256_cvtps_epi32(v)); }
+				static void store_bools(bool *destination, mask m) noexcept
+				{
+					const int bits = _mm256_movemask_ps(m);
+					for (std::size_t j = 0; j < width; ++j)
+						destination[j] = ((bits >> j) & 1) != 0;
+				}
+			};
+
+CXCM_TARGET_END
+#endif
+
+#if defined(CXCM_KERNELS_AVX512DQ) || defined(CXCM_KERNELS_AVX2)
+
+CXCM_GENERIC_KERNEL_BEGIN
+
+			// the same results as the scalar versions. returns how many values were done. relaxed_policy skips the
+			// screening, and reproducible_policy also hands back the screened values unchanged where the hardware would
+			// quiet a signaling NaN. Flush takes subnormal values as zeros.
+			template <typename Ops, elementwise Function, typename Policy, bool Flush, typename T>
+			CXCM_ALWAYS_INLINE std::size_t elementwise_kernel(const T *values, T *results, std::size_t count) noexcept
+			{
+				constexpr bool screening = !std::is_same_v<Policy, relaxed_policy>;
+
+				using vector = typename Ops::vector;
+
+				constexpr int to_floor = _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC;
+				constexpr int to_ceil = _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC;
+				constexpr int to_zero = _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC;
+				constexpr int to_nearest = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+
+				const vector zero = Ops::broadcast(T(0));
+				const vector half = Ops::broadcast(T(0.5f));
+				const vector one = Ops::broadcast(T(1));
+
+				std::size_t i = 0;
+				for (; i + Ops::width <= count; i += Ops::width)
+				{
+					vector x = Ops::load(values + i);
+					vector result;
+
+					if constexpr (Flush)
+						x = Ops::flush_subnormals(x);
+
+					if constexpr (Function == elementwise::floor)
+					{
+						result = Ops::template round<to_floor>(x);
+					}
+					else if constexpr (Function == elementwise::ceil)
+					{
+						result = Ops::template round<to_ceil>(x);
+					}
+					else if constexpr (Function == elementwise::trunc)
+					{
+						result = Ops::template round<to_zero>(x);
+					}
+					else if constexpr (Function == elementwise::round)
+					{
+						// one more step away from zero when at least half was cut off. x - trunc(x) is exact.
+						const vector truncated = Ops::template round<to_zero>(x);
+						result = Ops::add_where(Ops::greater_equal(Ops::abs(Ops::subtract(x, truncated)), half), truncated, Ops::copy_sign(one, x));
+					}
+					else if constexpr (Function == elementwise::round_even)
+					{
+						// adding zero makes the negative zeros positive, as the scalar version gives them
+						result = Ops::add(Ops::template round<to_nearest>(x), zero);
+					}
+					else if constexpr (Function == elementwise::fract)
+					{
+						// without the screening, -0 - -0 would be +0 where relaxed::fract() gives -0 - +0
+						if constexpr (screening)
+							result = Ops::subtract(x, Ops::template round<to_floor>(x));
+						else
+							result = Ops::subtract(x, Ops::add(Ops::template round<to_floor>(x), zero));
+					}
+					else
+					{
+						result = Ops::sqrt(x);
+					}
+
+					// the relaxed and constexpr versions round through an integer, so their zeros are positive too
+					constexpr bool integer_zeros = (Function == elementwise::floor) || (Function == elementwise::ceil) ||
+												   (Function == elementwise::trunc) || (Function == elementwise::round);
+					if constexpr (integer_zeros && !std::is_same_v<Policy, strict_policy>)
+						result = Ops::add(result, zero);
+
+					constexpr bool screened_function = (Function == elementwise::round_even) || (Function == elementwise::fract);
+					if constexpr ((screening && screened_function) || (std::is_same_v<Policy, reproducible_policy> && (Function != elementwise::sqrt)))
+						result = Ops::select(Ops::screened(x), x, result);
+
+					Ops::store(results + i, result);
+				}
+
+				return i;
+			}
+
+			// fpclassify() values as ints, the rest as bools
+			template <typename Ops, classification Function, typename T, typename R>
+			CXCM_ALWAYS_INLINE std::size_t classification_kernel(const T *values, R *results, std::size_t count) noexcept
+			{
+				using vector = typename Ops::vector;
+
+				std::size_t i = 0;
+				for (; i + Ops::width <= count; i += Ops::width)
+				{
+					const vector x = Ops::load(values + i);
+
+					if constexpr (Function == classification::fpclassify)
+						Ops::store_ints(results + i, Ops::classify(x));
+					else if constexpr (Function == classification::isnan)
+						Ops::store_bools(results + i, Ops::equal(Ops::classify(x), Ops::broadcast(T(FP_NAN))));
+					else if constexpr (Function == classification::isinf)
+						Ops::store_bools(results + i, Ops::equal(Ops::classify(x), Ops::broadcast(T(FP_INFINITE))));
+					else if constexpr (Function == classification::isfinite)
+						Ops::store_bools(results + i, Ops::equal(Ops::subtract(x, x), Ops::broadcast(T(0))));
+					else if constexpr (Function == classification::isnormal)
+						Ops::store_bools(results + i, Ops::equal(Ops::classify(x), Ops::broadcast(T(FP_NORMAL))));
+					else
+						Ops::store_bools(results + i, Ops::sign(x));
+				}
+
+				return i;
+			}
+
+CXCM_GENERIC_KERNEL_END
+
+#endif
+
+#if defined(CXCM_KERNELS_AVX512DQ)
+CXCM_TARGET_AVX512_BEGIN
+
+			template <elementwise Function, typename Policy, bool Flush, typename T>
+			CXCM_FLATTEN std::size_t elementwise_avx512(const T *values, T *results, std::size_t count) noexcept
+			{
+				return elementwise_kernel<avx512_elementwise_ops<T>, Function, Policy, Flush>(values, results, count);
+			}
+
+			template <classification Function, typename T, typename R>
+			CXCM_FLATTEN std::size_t classification_avx512(const T *values, R *results, std::size_t count) noexcept
+			{
+				return classification_kernel<avx512_elementwise_ops<T>, Function>(values, results, count);
+			}
+
+CXCM_TARGET_END
+#endif
+
+#if defined(CXCM_KERNELS_AVX2)
+CXCM_TARGET_AVX2_BEGIN
+
+			template <elementwise Function, typename Policy, bool Flush, typename T>
+			CXCM_FLATTEN std::size_t elementwise_avx2(const T *values, T *results, std::size_t count) noexcept
+			{
+				return elementwise_kernel<avx2_elementwise_ops<T>, Function, Policy, Flush>(values, results, count);
+			}
+
+			template <classification Function, typename T, typename R>
+			CXCM_FLATTEN std::size_t classification_avx2(const T *values, R *results, std::size_t count) noexcept
+			{
+				return classification_kernel<avx2_elementwise_ops<T>, Function>(values, results, count);
+			}
+
+CXCM_TARGET_END
+#endif
+
+			template <elementwise Function, typename Policy, bool Flush, typename T>
+			void elementwise_kernels(std::span<const T> values, std::span<T> results)
+			{
+				check_sizes(values.size(), results.size());
+
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+				{
+#if defined(CXCM_KERNELS_AVX512DQ)
+					if (detail::tier_enabled(tier::avx512))
+						i = elementwise_avx512<Function, kernel_policy<Policy>, Flush>(values.data(), results.data(), values.size());
+#endif
+#if defined(CXCM_KERNELS_AVX2)
+					if (detail::tier_enabled(tier::avx2))
+						i += elementwise_avx2<Function, kernel_policy<Policy>, Flush>(values.data() + i, results.data() + i, values.size() - i);
+#endif
+				}
+
+				for (; i < values.size(); ++i)
+					results[i] = elementwise_scalar<Function, Policy>(Flush ? flush_subnormal(values[i]) : values[i]);
+			}
+
+			// the policy is left out of the key when it is the default, and the flushed versions are tuned apart
+			template <typename T, typename Policy, bool Flush, typename R, typename Run>
+			void run_keyed(std::string_view function, std::span<const T> values, std::span<R> results, Run run)
+			{
+				if constexpr (std::is_same_v<Policy, strict_policy> && !Flush)
+					run_tuned<T>(function, values, results, run);
+				else if constexpr (std::is_same_v<Policy, strict_policy>)
+					run_tuned<T, flushed_subnormals>(function, values, results, run);
+				else if constexpr (!Flush)
+					run_tuned<T, Policy>(function, values, results, run);
+				else
+					run_tuned<T, Policy, flushed_subnormals>(function, values, results, run);
+			}
+
+			template <elementwise Function, typename Policy, subnormals Subnormals, typename T>
+			void apply_elementwise(std::span<const T> values, std::span<T> results)
+			{
+				constexpr std::array<std::string_view, 7> names = {"floor", "ceil", "trunc", "round", "round_even", "fract", "sqrt"};
+				constexpr bool flush = (Subnormals == subnormals::flush);
+
+				run_keyed<T, Policy, flush>(names[static_cast<std::size_t>(Function)], values, results, [](std::span<const T> v, std::span<T> r) { elementwise_kernels<Function, Policy, flush>(v, r); });
+			}
+
+			template <classification Function, typename T, typename R>
+			void classification_kernels(std::span<const T> values, std::span<R> results)
+			{
+				check_sizes(values.size(), results.size());
+
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+				{
+#if defined(CXCM_KERNELS_AVX512DQ)
+					if (detail::tier_enabled(tier::avx512))
+						i = classification_avx512<Function>(values.data(), results.data(), values.size());
+#endif
+#if defined(CXCM_KERNELS_AVX2)
+					if (detail::tier_enabled(tier::avx2))
+						i += classification_avx2<Function>(values.data() + i, results.data() + i, values.size() - i);
+#endif
+				}
+
+				for (; i < values.size(); ++i)
+					results[i] = classification_scalar<Function>(values[i]);
+			}
+
+			template <classification Function, typename T, typename R>
+			void apply_classification(std::span<const T> values, std::span<R> results)
+			{
+				constexpr std::array<std::string_view, 6> names = {"fpclassify", "isnan", "isinf", "isfinite", "isnormal", "signbit"};
+
+				run_tuned<T>(names[static_cast<std::size_t>(Function)], values, results, [](std::span<const T> v, std::span<R> r) { classification_kernels<Function>(v, r); });
+			}
+
+			// 1 / sqrt(x) a rounding or two off, then one correction step with the residual 1 - x * y * y, which the
+			// fmas give almost exactly. that is correctly rounded, as the scalar version is. float lanes are widened,
+			// since the double quotient already rounds to the same float. the scalar version's answers for NaN, zero,
+			// infinity, and negative values go in afterwards.
+
+#if defined(CXCM_KERNELS_AVX512)
+CXCM_TARGET_AVX512_BEGIN
+
+			// vfixupimm picks the answer for each class of input: the quieted input for NaN (2), +infinity for zero
+			// (5), +0 for +infinity (8), the default NaN for negative values and -infinity (3), and the computed value
+			// for one and positive values (0)
+			inline __m512d rsqrt_fixup_avx512(__m512d computed, __m512d x) noexcept
+			{
+				return _mm512_fixupimm_pd(computed, x, _mm512_set1_epi64(0x03830522), 0);
+			}
+
+			// only the sign of the lanes below the smallest normal value of T is kept. float lanes are flushed after
+			// they are widened.
+			template <typename T>
+			__m512d rsqrt_flush_avx512(__m512d x) noexcept
+			{
+				const __mmask8 subnormal = _mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(std::numeric_limits<T>::min()), _CMP_LT_OQ);
+				return _mm512_castsi512_pd(_mm512_mask_and_epi64(_mm512_castpd_si512(x), subnormal, _mm512_castpd_si512(x), _mm512_set1_epi64(std::numeric_limits<std::int64_t>::min())));
+			}
+
+			template <bool Flush, typename T>
+			std::size_t rsqrt_avx512(const T *values, T *results, std::size_t count) noexcept
+			{
+				const __m512d one = _mm512_set1_pd(1.0);
+				const __m512d half = _mm512_set1_pd(0.5);
+				const __m512d three_eighths = _mm512_set1_pd(0.375);
+
+				std::size_t i = 0;
+				for (; i + 8 <= count; i += 8)
+				{
+					if constexpr (std::is_same_v<T, float>)
+					{
+						__m512d x = _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(values + i));
+						if constexpr (Flush)
+							x = rsqrt_flush_avx512<T>(x);
+
+						const __m512d y = rsqrt_fixup_avx512(_mm512_div_pd(one, _mm512_maskz_sqrt_pd(0xFF, x)), x);
+						_mm256_storeu_ps(results + i, _mm512_maskz_cvtpd_ps(0xFF, y));
+					}
+					else
+					{
+						__m512d x = _mm512_loadu_pd(values + i);
+						if constexpr (Flush)
+							x = rsqrt_flush_avx512<T>(x);
+
+						const __m512d y = _mm512_div_pd(one, _mm512_maskz_sqrt_pd(0xFF, x));
+						const __m512d t = _mm512_mul_pd(x, y);
+						const __m512d t_error = _mm512_fmsub_pd(x, y, t);
+						const __m512d e = _mm512_fnmadd_pd(t_error, y, _mm512_fnmadd_pd(t, y, one));
+						const __m512d k = _mm512_fmadd_pd(_mm512_mul_pd(three_eighths, e), e, _mm512_mul_pd(half, e));
+						_mm512_storeu_pd(results + i, rsqrt_fixup_avx512(_mm512_fmadd_pd(y, k, y), x));
+					}
+				}
+
+				return i;
+			}
+
+CXCM_TARGET_END
+#endif
+
+#if defined(CXCM_KERNELS_FMA)
+CXCM_TARGET_AVX2_BEGIN
+
+			inline __m256d rsqrt_fixup_avx2(__m256d computed, __m256d x) noexcept
+			{
+				const __m256d zero = _mm256_setzero_pd();
+				const __m256d infinity = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+
+				computed = _mm256_blendv_pd(computed, zero, _mm256_cmp_pd(x, infinity, _CMP_EQ_OQ));
+				computed = _mm256_blendv_pd(computed, infinity, _mm256_cmp_pd(x, zero, _CMP_EQ_OQ));
+				computed = _mm256_blendv_pd(computed, _mm256_set1_pd(-std::numeric_limits<double>::quiet_NaN()), _mm256_cmp_pd(x, zero, _CMP_LT_OQ));
+				return _mm256_blendv_pd(computed, _mm256_add_pd(x, x), _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+			}
+
+			template <typename T>
+			__m256d rsqrt_flush_avx2(__m256d x) noexcept
+			{
+				const __m256d sign = _mm256_set1_pd(-0.0);
+				return _mm256_and_pd(x, _mm256_or_pd(_mm256_cmp_pd(_mm256_andnot_pd(sign, x), _mm256_set1_pd(std::numeric_limits<T>::min()), _CMP_NLT_UQ), sign));
+			}
+
+			template <bool Flush, typename T>
+			std::size_t rsqrt_avx2(const T *values, T *results, std::size_t count) noexcept
+			{
+				const __m256d one = _mm256_set1_pd(1.0);
+				const __m256d half = _mm256_set1_pd(0.5);
+				const __m256d three_eighths = _mm256_set1_pd(0.375);
+
+				std::size_t i = 0;
+				for (; i + 4 <= count; i += 4)
+				{
+					if constexpr (std::is_same_v<T, float>)
+					{
+						__m256d x = _mm256_cvtps_pd(_mm_loadu_ps(values + i));
+						if constexpr (Flush)
+							x = rsqrt_flush_avx2<T>(x);
+
+						const __m256d y = rsqrt_fixup_avx2(_mm256_div_pd(one, _mm256_sqrt_pd(x)), x);
+						_mm_storeu_ps(results + i, _mm256_cvtpd_ps(y));
+					}
+					else
+					{
+						__m256d x = _mm256_loadu_pd(values + i);
+						if constexpr (Flush)
+							x = rsqrt_flush_avx2<T>(x);
+
+						const __m256d y = _mm256_div_pd(one, _mm256_sqrt_pd(x));
+						const __m256d t = _mm256_mul_pd(x, y);
+						const __m256d t_error = _mm256_fmsub_pd(x, y, t);
+						const __m256d e = _mm256_fnmadd_pd(t_error, y, _mm256_fnmadd_pd(t, y, one));
+						const __m256d k = _mm256_fmadd_pd(_mm256_mul_pd(three_eighths, e), e, _mm256_mul_pd(half, e));
+						_mm256_storeu_pd(results + i, rsqrt_fixup_avx2(_mm256_fmadd_pd(y, k, y), x));
+					}
+				}
+
+				return i;
+			}
+
+CXCM_TARGET_END
+#endif
+
+			// the kernels are correctly rounded, so fast_policy gets them and the exact scalar version too
+			template <typename Policy, bool Flush, typename T>
+			void rsqrt_kernels(std::span<const T> values, std::span<T> results)
+			{
+				check_sizes(values.size(), results.size());
+
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+				{
+#if defined(CXCM_KERNELS_AVX512)
+					if (detail::tier_enabled(tier::avx512))
+						i = rsqrt_avx512<Flush>(values.data(), results.data(), values.size());
+#endif
+#if defined(CXCM_KERNELS_FMA)
+					if (detail::tier_enabled(tier::avx2))
+						i += rsqrt_avx2<Flush>(values.data() + i, results.data() + i, values.size() - i);
+#endif
+				}
+
+				for (; i < values.size(); ++i)
+					results[i] = cxcm::rsqrt<kernel_policy<Policy>>(Flush ? flush_subnormal(values[i]) : values[i]);
+			}
+
+			template <typename Policy, subnormals Subnormals, typename T>
+			void apply_rsqrt(std::span<const T> values, std::span<T> results)
+			{
+				constexpr bool flush = (Subnormals == subnormals::flush);
+
+				run_keyed<T, Policy, flush>("rsqrt", values, results, [](std::span<const T> v, std::span<T> r) { rsqrt_kernels<Policy, flush>(v, r); });
+			}
+
+		}	// namespace detail
+
+		// the same results as the scalar versions, bit for bit. float and double values are done a vector at a
+		// time when compiled for AVX2 or AVX-512. the Policy overloads give the same results as the scalar
+		// cxcm::floor<Policy>() and friends, e.g. batch::floor<cxcm::reproducible_policy, double>(values, results).
+		// subnormals::flush gives the results for the values with their subnormals made zeros, e.g.
+		// batch::sqrt<double, batch::subnormals::flush>(values, results).
+
+		template <cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void floor(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::floor, strict_policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void floor(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::floor, Policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void ceil(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::ceil, strict_policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void ceil(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::ceil, Policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void trunc(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::trunc, strict_policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void trunc(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::trunc, Policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void round(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::round, strict_policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void round(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::round, Policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void round_even(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::round_even, strict_policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void round_even(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::round_even, Policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void fract(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::fract, strict_policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void fract(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::fract, Policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void sqrt(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::sqrt, strict_policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void sqrt(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_elementwise<detail::elementwise::sqrt, Policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void rsqrt(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_rsqrt<strict_policy, Subnormals>(values, results);
+		}
+
+		template <cxcm::concepts::policy Policy, cxcm::concepts::basic_floating_point T, subnormals Subnormals = subnormals::keep>
+		void rsqrt(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::apply_rsqrt<Policy, Subnormals>(values, results);
+		}
+
+		//
+		// approx<Bits> - sqrt(), rsqrt(), recip(), exp2(), log2()
+		//
+
+		namespace detail
+		{
+			// the approximations have no branches, so a block of them vectorizes for whatever the translation unit is
+			// compiled for
+			template <typename T, typename Function>
+			void apply_blocks(std::span<const T> values, std::span<T> results, Function f)
+			{
+				check_sizes(values.size(), results.size());
+
+				const T *input = values.data();
+				T *output = results.data();
+				const std::size_t count = values.size();
+				const std::size_t block_count = count - count % lane_count;
+				std::size_t i = 0;
+
+				for (; i < block_count; i += lane_count)
+				{
+					T lanes[lane_count];
+
+					for (std::size_t lane = 0; lane < lane_count; ++lane)
+						lanes[lane] = f(input[i + lane]);
+
+					for (std::size_t lane = 0; lane < lane_count; ++lane)
+						output[i + lane] = lanes[lane];
+				}
+
+				for (; i < count; ++i)
+					output[i] = f(input[i]);
+			}
+		}	// namespace detail
+
+		// the same results as cxcm::approx<Bits>, bit for bit
+
+		template <int Bits>
+		struct approx
+		{
+			template <cxcm::concepts::basic_floating_point T>
+			requires (Bits <= cxcm::approx<Bits>::template max_bits<T>)
+			static void sqrt(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+			{
+				detail::apply_blocks(values, results, [](T value) { return cxcm::approx<Bits>::sqrt(value); });
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			requires (Bits <= cxcm::approx<Bits>::template max_bits<T>)
+			static void rsqrt(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+			{
+				detail::apply_blocks(values, results, [](T value) { return cxcm::approx<Bits>::rsqrt(value); });
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			requires (Bits <= cxcm::approx<Bits>::template max_bits<T>)
+			static void recip(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+			{
+				detail::apply_blocks(values, results, [](T value) { return cxcm::approx<Bits>::recip(value); });
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			requires (Bits <= cxcm::approx<Bits>::template max_bits<T>)
+			static void exp2(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+			{
+				detail::apply_blocks(values, results, [](T value) { return cxcm::approx<Bits>::exp2(value); });
+			}
+
+			template <cxcm::concepts::basic_floating_point T>
+			requires (Bits <= cxcm::approx<Bits>::template max_bits<T>)
+			static void log2(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+			{
+				detail::apply_blocks(values, results, [](T value) { return cxcm::approx<Bits>::log2(value); });
+			}
+		};
+
+		//
+		// fpclassify(), isnan(), isinf(), isfinite(), isnormal(), signbit()
+		//
+
+		template <cxcm::concepts::basic_floating_point T>
+		void fpclassify(std::type_identity_t<std::span<const T>> values, std::span<int> results)
+		{
+			detail::apply_classification<detail::classification::fpclassify, T, int>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		void isnan(std::type_identity_t<std::span<const T>> values, std::span<bool> results)
+		{
+			detail::apply_classification<detail::classification::isnan, T, bool>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		void isinf(std::type_identity_t<std::span<const T>> values, std::span<bool> results)
+		{
+			detail::apply_classification<detail::classification::isinf, T, bool>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		void isfinite(std::type_identity_t<std::span<const T>> values, std::span<bool> results)
+		{
+			detail::apply_classification<detail::classification::isfinite, T, bool>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		void isnormal(std::type_identity_t<std::span<const T>> values, std::span<bool> results)
+		{
+			detail::apply_classification<detail::classification::isnormal, T, bool>(values, results);
+		}
+
+		template <cxcm::concepts::basic_floating_point T>
+		void signbit(std::type_identity_t<std::span<const T>> values, std::span<bool> results)
+		{
+			detail::apply_classification<detail::classification::signbit, T, bool>(values, results);
+		}
+
+		//
+		// fmod() - the same divisor for every value
+		//
+
+		namespace detail
+		{
+			// q = trunc(|x| * (1 / |y|) rounded up a little) is never below the true quotient and at most one above,
+			// so fma(-q, |y|, |x|) is exact and only needs one |y| added back when negative. lanes where the quotient
+			// could be too big for that, along with infinity and NaN, go through std::fmod.
+
+			template <typename T>
+			struct fmod_constants
+			{
+				T widening;
+				T quotient_limit;
+			};
+
+			template <typename T>
+			constexpr fmod_constants<T> fmod_limits() noexcept
+			{
+				if constexpr (std::is_same_v<T, float>)
+					return {1.0f + 0x1.0p-21f, 0x1.0p19f};
+				else
+					return {1.0 + 0x1.0p-50, 0x1.0p48};
 			}
 
-			//
-			// constexpr_fract()
-			//
-
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T constexpr_fract(T value) noexcept
+			// the reciprocal every lane uses, or 0 if the divisor can't be done in simd at all
+			template <typename T>
+			T fmod_reciprocal(T divisor) noexcept
 			{
-#if !defined(__GNUC__) || defined(__clang__)
-				if (isnan(value))
-					return convert_to_quiet_nan(value);
-#endif
+				const T magnitude = std::abs(divisor);
+				if (!(magnitude > 0) || !(magnitude < std::numeric_limits<T>::infinity()))
+					return 0;
 
-				// screen out unnecessary input
-				if (fails_fractional_input_constraints(value))
-					return value;
+				const T reciprocal = (1 / magnitude) * fmod_limits<T>().widening;
+				if (!(reciprocal < std::numeric_limits<T>::infinity()))
+					return 0;
 
-				return relaxed::fract(value);
+				return reciprocal;
 			}
 
-			//
-			// constexpr_fmod()
-			//
+#if defined(CXCM_KERNELS_AVX512)
+CXCM_TARGET_AVX512_BEGIN
 
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T constexpr_fmod(T x, T y) noexcept
+			template <typename T>
+			std::size_t fmod_avx512(const T *values, T divisor, T *results, std::size_t count) noexcept
 			{
-				// screen out unnecessary input
+				const T reciprocal = fmod_reciprocal(divisor);
+				if (reciprocal == 0)
+					return 0;
 
-				if (isnan(x) || isnan(y) || !isfinite(x))
-					return std::numeric_limits<T>::quiet_NaN();
+				std::size_t i = 0;
 
-				if (isinf(y))
-					return x;
+				if constexpr (std::is_same_v<T, float>)
+				{
+					const __m512 y = _mm512_set1_ps(std::abs(divisor));
+					const __m512 inverse = _mm512_set1_ps(reciprocal);
+					const __m512 limit = _mm512_set1_ps(fmod_limits<float>().quotient_limit);
+					const __m512i sign = _mm512_set1_epi32(std::numeric_limits<std::int32_t>::min());
 
-				if (x == T(0) && y != T(0))
-					return x;
+					for (; i + 16 <= count; i += 16)
+					{
+						const __m512 x = _mm512_loadu_ps(values + i);
+						const __m512 magnitude = _mm512_abs_ps(x);
+						const __m512 estimate = _mm512_mul_ps(magnitude, inverse);
+						const __mmask16 fast = _mm512_cmp_ps_mask(estimate, limit, _CMP_LT_OQ);
+
+						const __m512 q = _mm512_mask_roundscale_ps(estimate, 0xFFFF, estimate, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+						__m512 r = _mm512_fnmadd_ps(q, y, magnitude);
+						r = _mm512_mask_add_ps(r, _mm512_cmp_ps_mask(r, _mm512_setzero_ps(), _CMP_LT_OQ), r, y);
+						r = _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(r), _mm512_and_si512(_mm512_castps_si512(x), sign)));
+
+						_mm512_storeu_ps(results + i, r);
+
+						for (unsigned slow = static_cast<unsigned>(static_cast<__mmask16>(~fast)); slow != 0; slow &= slow - 1)
+						{
+							const std::size_t j = i + static_cast<std::size_t>(std::countr_zero(slow));
+							results[j] = std::fmod(values[j], divisor);
+						}
+					}
+				}
+				else
+				{
+					const __m512d y = _mm512_set1_pd(std::abs(divisor));
+					const __m512d inverse = _mm512_set1_pd(reciprocal);
+					const __m512d limit = _mm512_set1_pd(fmod_limits<double>().quotient_limit);
+					const __m512i sign = _mm512_set1_epi64(std::numeric_limits<std::int64_t>::min());
 
-				if (y == 0)
-					return std::numeric_limits<T>::quiet_NaN();
+					for (; i + 8 <= count; i += 8)
+					{
+						const __m512d x = _mm512_loadu_pd(values + i);
+						const __m512d magnitude = _mm512_abs_pd(x);
+						const __m512d estimate = _mm512_mul_pd(magnitude, inverse);
+						const __mmask8 fast = _mm512_cmp_pd_mask(estimate, limit, _CMP_LT_OQ);
+
+						const __m512d q = _mm512_mask_roundscale_pd(estimate, 0xFF, estimate, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+						__m512d r = _mm512_fnmadd_pd(q, y, magnitude);
+						r = _mm512_mask_add_pd(r, _mm512_cmp_pd_mask(r, _mm512_setzero_pd(), _CMP_LT_OQ), r, y);
+						r = _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(r), _mm512_and_si512(_mm512_castpd_si512(x), sign)));
+
+						_mm512_storeu_pd(results + i, r);
+
+						for (unsigned slow = static_cast<unsigned>(static_cast<__mmask8>(~fast)); slow != 0; slow &= slow - 1)
+						{
+							const std::size_t j = i + static_cast<std::size_t>(std::countr_zero(slow));
+							results[j] = std::fmod(values[j], divisor);
+						}
+					}
+				}
 
-				return relaxed::fmod(x, y);
+				return i;
 			}
 
-			//
-			// constexpr_round_even()
-			//
+CXCM_TARGET_END
+#endif
 
-			// rounds to nearest integral position, halfway cases away from zero
+#if defined(CXCM_KERNELS_FMA)
+CXCM_TARGET_AVX2_BEGIN
 
-			template <cxcm::concepts::basic_floating_point T>
-			constexpr T constexpr_round_even(T value) noexcept
+			template <typename T>
+			std::size_t fmod_avx2(const T *values, T divisor, T *results, std::size_t count) noexcept
 			{
-#if !defined(__GNUC__) || defined(__clang__)
-				if (isnan(value))
-					return convert_to_quiet_nan(value);
-#endif
+				const T reciprocal = fmod_reciprocal(divisor);
+				if (reciprocal == 0)
+					return 0;
 
-				// screen out unnecessary input
-				if (fails_fractional_input_constraints(value))
-					return value;
+				std::size_t i = 0;
 
-				// halfway rounding can bump into max long long value for truncation
-				// (for extended precision), so be more gentle at the end points.
-				// this works because the largest_fractional_value remainder is T(0.5f).
-				if (value == limits::largest_fractional_value<T>)
-					return value + T(0.5f);
-				else if (value == -limits::largest_fractional_value<T>)			// we technically don't have to do this for negative case (one more number in negative range)
-					return value - T(0.5f);
+				if constexpr (std::is_same_v<T, float>)
+				{
+					const __m256 y = _mm256_set1_ps(std::abs(divisor));
+					const __m256 inverse = _mm256_set1_ps(reciprocal);
+					const __m256 limit = _mm256_set1_ps(fmod_limits<float>().quotient_limit);
+					const __m256 sign = _mm256_set1_ps(-0.0f);
 
-				return relaxed::round_even(value);
-			}
+					for (; i + 8 <= count; i += 8)
+					{
+						const __m256 x = _mm256_loadu_ps(values + i);
+						const __m256 magnitude = _mm256_andnot_ps(sign, x);
+						const __m256 estimate = _mm256_mul_ps(magnitude, inverse);
+						const int fast = _mm256_movemask_ps(_mm256_cmp_ps(estimate, limit, _CMP_LT_OQ));
+
+						const __m256 q = _mm256_round_ps(estimate, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+						__m256 r = _mm256_fnmadd_ps(q, y, magnitude);
+						r = _mm256_add_ps(r, _mm256_and_ps(y, _mm256_cmp_ps(r, _mm256_setzero_ps(), _CMP_LT_OQ)));
+						r = _mm256_or_ps(r, _mm256_and_ps(x, sign));
+
+						_mm256_storeu_ps(results + i, r);
+
+						for (unsigned slow = static_cast<unsigned>(~fast & 0xFF); slow != 0; slow &= slow - 1)
+						{
+							const std::size_t j = i + static_cast<std::size_t>(std::countr_zero(slow));
+							results[j] = std::fmod(values[j], divisor);
+						}
+					}
+				}
+				else
+				{
+					const __m256d y = _mm256_set1_pd(std::abs(divisor));
+					const __m256d inverse = _mm256_set1_pd(reciprocal);
+					const __m256d limit = _mm256_set1_pd(fmod_limits<double>().quotient_limit);
+					const __m256d sign = _mm256_set1_pd(-0.0);
 
-			//
-			// constexpr_sqrt()
-			//
+					for (; i + 4 <= count; i += 4)
+					{
+						const __m256d x = _mm256_loadu_pd(values + i);
+						const __m256d magnitude = _mm256_andnot_pd(sign, x);
+						const __m256d estimate = _mm256_mul_pd(magnitude, inverse);
+						const int fast = _mm256_movemask_pd(_mm256_cmp_pd(estimate, limit, _CMP_LT_OQ));
+
+						const __m256d q = _mm256_round_pd(estimate, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+						__m256d r = _mm256_fnmadd_pd(q, y, magnitude);
+						r = _mm256_add_pd(r, _mm256_and_pd(y, _mm256_cmp_pd(r, _mm256_setzero_pd(), _CMP_LT_OQ)));
+						r = _mm256_or_pd(r, _mm256_and_pd(x, sign));
+
+						_mm256_storeu_pd(results + i, r);
+
+						for (unsigned slow = static_cast<unsigned>(~fast & 0xF); slow != 0; slow &= slow - 1)
+						{
+							const std::size_t j = i + static_cast<std::size_t>(std::countr_zero(slow));
+							results[j] = std::fmod(values[j], divisor);
+						}
+					}
+				}
 
-			// make sure this isn't optimized away if used with fast-math
+				return i;
+			}
 
-#if defined(_MSC_VER) || defined(__clang__)
-#pragma float_control(precise, on, push)
+CXCM_TARGET_END
 #endif
+		}
 
-			template <cxcm::concepts::basic_floating_point T>
-#if defined(__GNUC__) && !defined(__clang__)
-			__attribute__((optimize("-fno-fast-math")))
+		// every value gets the same divisor. exact, and bit for bit the same as std::fmod.
+		template <cxcm::concepts::basic_floating_point T>
+		void fmod(std::type_identity_t<std::span<const T>> values, T divisor, std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			std::size_t i = 0;
+
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			{
+#if defined(CXCM_KERNELS_AVX512)
+				if (detail::tier_enabled(tier::avx512))
+					i = detail::fmod_avx512(values.data(), divisor, results.data(), values.size());
 #endif
-			constexpr T constexpr_sqrt(T value) noexcept
+#if defined(CXCM_KERNELS_FMA)
+				if (detail::tier_enabled(tier::avx2))
+					i += detail::fmod_avx2(values.data() + i, divisor, results.data() + i, values.size() - i);
+#endif
+			}
+
+			for (; i < values.size(); ++i)
+				results[i] = std::fmod(values[i], divisor);
+		}
+
+		//
+		// wrap(), distance() - periodic intervals
+		//
+
+		namespace detail
+		{
+			// periodic::reduce() a vector at a time, with the same double-double steps, always in double lanes. float
+			// values are widened going in and rounded coming out, like the scalar version.
+
+#if defined(CXCM_KERNELS_AVX512)
+CXCM_TARGET_AVX512_BEGIN
+
+			template <typename T>
+			struct avx512_periodic_ops
 			{
-				// screen out unnecessary input
+				using vector = __m512d;
+				using mask = __mmask8;
+				static constexpr std::size_t width = 8;
 
-				if (isnan(value))
+				static vector load(const T *source) noexcept
 				{
-					return detail::convert_to_quiet_nan(value);
+					if constexpr (std::is_same_v<T, float>)
+						return _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(source));
+					else
+						return _mm512_loadu_pd(source);
 				}
-				else if (value == std::numeric_limits<T>::infinity())
+
+				static void store(T *destination, vector v) noexcept
 				{
-					return value;
+					if constexpr (std::is_same_v<T, float>)
+						_mm256_storeu_ps(destination, _mm512_maskz_cvtpd_ps(0xFF, v));
+					else
+						_mm512_storeu_pd(destination, v);
 				}
-				else if (value == -std::numeric_limits<T>::infinity())
+
+				// rounded to T, still in double lanes
+				static vector round(vector v) noexcept
 				{
-					return -std::numeric_limits<T>::quiet_NaN();
+					if constexpr (std::is_same_v<T, float>)
+						return _mm512_maskz_cvtps_pd(0xFF, _mm512_maskz_cvtpd_ps(0xFF, v));
+					else
+						return v;
 				}
-				else if (value == T(0))
+
+				static vector broadcast(double value) noexcept { return _mm512_set1_pd(value); }
+				static vector add(vector a, vector b) noexcept { return _mm512_add_pd(a, b); }
+				static vector subtract(vector a, vector b) noexcept { return _mm512_sub_pd(a, b); }
+				static vector multiply(vector a, vector b) noexcept { return _mm512_mul_pd(a, b); }
+				static vector multiply_subtract(vector a, vector b, vector c) noexcept { return _mm512_fmsub_pd(a, b, c); }
+				static vector negate(vector v) noexcept { return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(v), _mm512_set1_epi64(std::numeric_limits<std::int64_t>::min()))); }
+				static vector abs(vector v) noexcept { return _mm512_abs_pd(v); }
+				static vector floor(vector v) noexcept { return _mm512_mask_roundscale_pd(v, 0xFF, v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+
+				// two_sum() and quick_two_sum(), as in dd_real
+				static vector two_sum(vector a, vector b, vector &error) noexcept
 				{
-					return value;
+					const vector s = add(a, b);
+					const vector v = subtract(s, a);
+					error = add(subtract(a, subtract(s, v)), subtract(b, v));
+					return s;
 				}
-				else if (value < T(0))
+
+				static vector quick_two_sum(vector a, vector b, vector &error) noexcept
 				{
-					return -std::numeric_limits<T>::quiet_NaN();
+					const vector s = add(a, b);
+					error = subtract(b, subtract(s, a));
+					return s;
 				}
 
-				return relaxed::sqrt(value);
-			}
+				static mask less(vector a, vector b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+				static mask less_equal(vector a, vector b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+				static mask equal(vector a, vector b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+				static mask both(mask a, mask b) noexcept { return a & b; }
+				static mask either(mask a, mask b) noexcept { return a | b; }
+				static vector select(mask m, vector a, vector b) noexcept { return _mm512_mask_blend_pd(m, b, a); }
+				static unsigned bits(mask m) noexcept { return m; }
+			};
 
-#if defined(_MSC_VER) || defined(__clang__)
-#pragma float_control(pop)
+CXCM_TARGET_END
 #endif
 
-			//
-			// constexpr_inverse_sqrt()
-			//
-
-			// make sure this isn't optimized away if used with fast-math
-
-#if defined(_MSC_VER) || defined(__clang__)
-#pragma float_control(precise, on, push)
-#endif
+#if defined(CXCM_KERNELS_FMA)
+CXCM_TARGET_AVX2_BEGIN
 
-			template <cxcm::concepts::basic_floating_point T>
-#if defined(__GNUC__) && !defined(__clang__)
-			__attribute__((optimize("-fno-fast-math")))
-#endif
-			constexpr T constexpr_rsqrt(T value) noexcept
+			template <typename T>
+			struct avx2_periodic_ops
 			{
-				// screen out unnecessary input
+				using vector = __m256d;
+				using mask = __m256d;
+				static constexpr std::size_t width = 4;
 
-				if (isnan(value))
+				static vector load(const T *source) noexcept
 				{
-					return detail::convert_to_quiet_nan(value);
+					if constexpr (std::is_same_v<T, float>)
+						return _mm256_cvtps_pd(_mm_loadu_ps(source));
+					else
+						return _mm256_loadu_pd(source);
 				}
-				else if (value == std::numeric_limits<T>::infinity())
+
+				static void store(T *destination, vector v) noexcept
 				{
-					return T(0);
+					if constexpr (std::is_same_v<T, float>)
+						_mm_storeu_ps(destination, _mm256_cvtpd_ps(v));
+					else
+						_mm256_storeu_pd(destination, v);
 				}
-				else if (value == -std::numeric_limits<T>::infinity())
+
+				static vector round(vector v) noexcept
 				{
-					return -std::numeric_limits<T>::quiet_NaN();
+					if constexpr (std::is_same_v<T, float>)
+						return _mm256_cvtps_pd(_mm256_cvtpd_ps(v));
+					else
+						return v;
 				}
-				else if (value == T(0))
+
+				static vector broadcast(double value) noexcept { return _mm256_set1_pd(value); }
+				static vector add(vector a, vector b) noexcept { return _mm256_add_pd(a, b); }
+				static vector subtract(vector a, vector b) noexcept { return _mm256_sub_pd(a, b); }
+				static vector multiply(vector a, vector b) noexcept { return _mm256_mul_pd(a, b); }
+				static vector multiply_subtract(vector a, vector b, vector c) noexcept { return _mm256_fmsub_pd(a, b, c); }
+				static vector negate(vector v) noexcept { return _mm256_xor_pd(v, _mm256_set1_pd(-0.0)); }
+				static vector abs(vector v) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v); }
+				static vector floor(vector v) noexcept { return _mm256_floor_pd(v); }
+
+				// two_sum() and quick_two_sum(), as in dd_real
+				static vector two_sum(vector a, vector b, vector &error) noexcept
 				{
-					return std::numeric_limits<T>::infinity();
+					const vector s = add(a, b);
+					const vector v = subtract(s, a);
+					error = add(subtract(a, subtract(s, v)), subtract(b, v));
+					return s;
 				}
-				else if (value < T(0))
+
+				static vector quick_two_sum(vector a, vector b, vector &error) noexcept
 				{
-					return -std::numeric_limits<T>::quiet_NaN();
+					const vector s = add(a, b);
+					error = subtract(b, subtract(s, a));
+					return s;
 				}
 
-				return relaxed::rsqrt(value);
+				static mask less(vector a, vector b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+				static mask less_equal(vector a, vector b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+				static mask equal(vector a, vector b) noexcept { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+				static mask both(mask a, mask b) noexcept { return _mm256_and_pd(a, b); }
+				static mask either(mask a, mask b) noexcept { return _mm256_or_pd(a, b); }
+				static vector select(mask m, vector a, vector b) noexcept { return _mm256_blendv_pd(b, a, m); }
+				static unsigned bits(mask m) noexcept { return static_cast<unsigned>(_mm256_movemask_pd(m)); }
+			};
+
+CXCM_TARGET_END
+#endif
+
+#if defined(CXCM_KERNELS_AVX512) || defined(CXCM_KERNELS_FMA)
+
+CXCM_GENERIC_KERNEL_BEGIN
+
+			// wrap() when bases is null, otherwise distance() from bases[i] to values[i]. lanes too far apart for the
+			// double-double quotient, or not finite, go through the scalar version. returns how many values were done.
+			template <typename Ops, typename T>
+			CXCM_ALWAYS_INLINE std::size_t periodic_kernel(const periodic<T> &interval, const T *values, const T *bases, T *results, std::size_t count) noexcept
+			{
+				using vector = typename Ops::vector;
+
+				const bool centered = (bases != nullptr);
+				const double length = static_cast<double>(interval.period);
+
+				const vector period = Ops::broadcast(length);
+				const vector negative_period = Ops::broadcast(-length);
+				const vector zero = Ops::broadcast(0.0);
+				const vector reciprocal_high = Ops::broadcast(interval.reciprocal[0]);
+				const vector reciprocal_low = Ops::broadcast(interval.reciprocal[1]);
+				const vector limit = Ops::broadcast(length * cxcm::detail::periodic_quotient_limit);
+				const vector offset = Ops::broadcast(centered ? 0.5 : 0.0);
+				const vector low = Ops::broadcast(centered ? -0.5 * length : 0.0);
+				const vector high = Ops::broadcast(centered ? 0.5 * length : length);
+				const vector lo = Ops::broadcast(static_cast<double>(interval.lo));
+				const vector hi = Ops::broadcast(static_cast<double>(interval.hi));
+				const vector half = Ops::broadcast(static_cast<double>(interval.period / 2));
+				const vector negative_half = Ops::broadcast(-static_cast<double>(interval.period / 2));
+				const unsigned all = (1u << Ops::width) - 1;
+
+				std::size_t i = 0;
+				for (; i + Ops::width <= count; i += Ops::width)
+				{
+					const vector x = Ops::load(values + i);
+					const vector base = centered ? Ops::load(bases + i) : lo;
+
+					vector d_low;
+					const vector d_high = Ops::two_sum(x, Ops::negate(base), d_low);
+					const unsigned fast = Ops::bits(Ops::less(Ops::abs(d_high), limit));
+
+					// (d * reciprocal)[0], then the nearest whole number of periods below
+					const vector p_high = Ops::multiply(d_high, reciprocal_high);
+					const vector p_low = Ops::add(Ops::multiply_subtract(d_high, reciprocal_high, p_high), Ops::add(Ops::multiply(d_high, reciprocal_low), Ops::multiply(d_low, reciprocal_high)));
+					const vector quotient = Ops::floor(Ops::add(Ops::add(p_high, p_low), offset));
+
+					// d - quotient * period
+					const vector product = Ops::multiply(quotient, period);
+					const vector product_error = Ops::multiply_subtract(quotient, period, product);
+
+					vector s2;
+					vector t2;
+					vector s1 = Ops::two_sum(d_high, Ops::negate(product), s2);
+					const vector t1 = Ops::two_sum(d_low, Ops::negate(product_error), t2);
+					s2 = Ops::add(s2, t1);
+					s1 = Ops::quick_two_sum(s1, s2, s2);
+					s2 = Ops::add(s2, t2);
+
+					vector r_low;
+					vector r_high = Ops::quick_two_sum(s1, s2, r_low);
+
+					// off by one period either way
+					const auto below = Ops::either(Ops::less(r_high, low), Ops::both(Ops::equal(r_high, low), Ops::less(r_low, zero)));
+					const auto above = Ops::either(Ops::less(high, r_high), Ops::both(Ops::equal(r_high, high), Ops::less_equal(zero, r_low)));
+					const vector adjustment = Ops::select(below, period, negative_period);
+
+					vector a2;
+					const vector a1 = Ops::two_sum(r_high, adjustment, a2);
+					vector a_low;
+					const vector a_high = Ops::quick_two_sum(a1, Ops::add(a2, r_low), a_low);
+
+					const auto adjust = Ops::either(below, above);
+					r_high = Ops::select(adjust, a_high, r_high);
+					r_low = Ops::select(adjust, a_low, r_low);
+
+					vector result;
+					if (centered)
+					{
+						result = Ops::round(r_high);
+						result = Ops::add(Ops::select(Ops::less(result, half), result, negative_half), zero);
+					}
+					else
+					{
+						vector e2;
+						const vector e1 = Ops::two_sum(r_high, lo, e2);
+						result = Ops::round(Ops::add(e1, Ops::add(e2, r_low)));
+						result = Ops::select(Ops::both(Ops::less(result, hi), Ops::less(lo, result)), result, lo);
+					}
+
+					Ops::store(results + i, result);
+
+					for (unsigned slow = ~fast & all; slow != 0; slow &= slow - 1)
+					{
+						const std::size_t j = i + static_cast<std::size_t>(std::countr_zero(slow));
+						results[j] = centered ? interval.distance(bases[j], values[j]) : interval.wrap(values[j]);
+					}
+				}
+
+				return i;
 			}
 
-#if defined(_MSC_VER) || defined(__clang__)
-#pragma float_control(pop)
+CXCM_GENERIC_KERNEL_END
+
 #endif
 
-			// make sure this isn't optimized away if used with fast-math
+			// periodic_kernel() built for each tier, with the ops inlined into it
 
-#if defined(_MSC_VER) || defined(__clang__)
-#pragma float_control(precise, on, push)
+#if defined(CXCM_KERNELS_AVX512)
+CXCM_TARGET_AVX512_BEGIN
+
+			template <typename T>
+			CXCM_FLATTEN std::size_t periodic_avx512(const periodic<T> &interval, const T *values, const T *bases, T *results, std::size_t count) noexcept
+			{
+				return periodic_kernel<avx512_periodic_ops<T>>(interval, values, bases, results, count);
+			}
+
+CXCM_TARGET_END
 #endif
 
-			template <cxcm::concepts::basic_floating_point T>
-#if defined(__GNUC__) && !defined(__clang__)
-			__attribute__((optimize("-fno-fast-math")))
+#if defined(CXCM_KERNELS_FMA)
+CXCM_TARGET_AVX2_BEGIN
+
+			template <typename T>
+			CXCM_FLATTEN std::size_t periodic_avx2(const periodic<T> &interval, const T *values, const T *bases, T *results, std::size_t count) noexcept
+			{
+				return periodic_kernel<avx2_periodic_ops<T>>(interval, values, bases, results, count);
+			}
+
+CXCM_TARGET_END
 #endif
-			constexpr T constexpr_fast_rsqrt(T value) noexcept
+
+		}
+
+		// interval.wrap(values[i]) for every value
+		template <cxcm::detail::periodic_floating_point T>
+		void wrap(const periodic<T> &interval, std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(values.size(), results.size());
+
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX512)
+			if (detail::tier_enabled(tier::avx512))
+				i = detail::periodic_avx512(interval, values.data(), static_cast<const T *>(nullptr), results.data(), values.size());
+#endif
+#if defined(CXCM_KERNELS_FMA)
+			if (detail::tier_enabled(tier::avx2))
+				i += detail::periodic_avx2(interval, values.data() + i, static_cast<const T *>(nullptr), results.data() + i, values.size() - i);
+#endif
+
+			for (; i < values.size(); ++i)
+				results[i] = interval.wrap(values[i]);
+		}
+
+		// interval.distance(from[i], to[i]) for every pair
+		template <cxcm::detail::periodic_floating_point T>
+		void distance(const periodic<T> &interval, std::type_identity_t<std::span<const T>> from, std::type_identity_t<std::span<const T>> to,
+					  std::type_identity_t<std::span<T>> results)
+		{
+			detail::check_sizes(from.size(), to.size());
+			detail::check_sizes(from.size(), results.size());
+
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX512)
+			if (detail::tier_enabled(tier::avx512))
+				i = detail::periodic_avx512(interval, to.data(), from.data(), results.data(), from.size());
+#endif
+#if defined(CXCM_KERNELS_FMA)
+			if (detail::tier_enabled(tier::avx2))
+				i += detail::periodic_avx2(interval, to.data() + i, from.data() + i, results.data() + i, from.size() - i);
+#endif
+
+			for (; i < from.size(); ++i)
+				results[i] = interval.distance(from[i], to[i]);
+		}
+
+		//
+		// frexp(), ldexp(), scalbn(), ilogb(), logb() - exponent manipulation
+		//
+
+		namespace detail
+		{
+#if defined(CXCM_KERNELS_AVX512)
+CXCM_TARGET_AVX512_BEGIN
+
+			// vgetexp, vgetmant, and vscalef handle subnormals in hardware. the masked forms sidestep gcc warnings
+			// about the undefined source of the unmasked ones. each returns how many values were done.
+
+			template <typename T>
+			std::size_t frexp_avx512(const T *values, T *fractions, int *exponents, std::size_t count) noexcept
 			{
-				// screen out unnecessary input
+				std::size_t i = 0;
 
-				if (isnan(value))
+				if constexpr (std::is_same_v<T, float>)
 				{
-					return detail::convert_to_quiet_nan(value);
+					const __m512 infinity = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+
+					for (; i + 16 <= count; i += 16)
+					{
+						const __m512 x = _mm512_loadu_ps(values + i);
+
+						// zero, infinity, and NaN keep their value, with an exponent of 0
+						const __mmask16 ordinary = _mm512_cmp_ps_mask(_mm512_abs_ps(x), infinity, _CMP_LT_OQ) & _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_NEQ_OQ);
+						const __m512 exponent = _mm512_maskz_getexp_ps(ordinary, x);
+
+						_mm512_storeu_ps(fractions + i, _mm512_mask_getmant_ps(x, ordinary, x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+						_mm512_storeu_si512(exponents + i, _mm512_maskz_cvtps_epi32(ordinary, _mm512_add_ps(exponent, _mm512_set1_ps(1.0f))));
+					}
 				}
-				else if (value == std::numeric_limits<T>::infinity())
+				else
 				{
-					return T(0);
+					const __m512d infinity = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+
+					for (; i + 8 <= count; i += 8)
+					{
+						const __m512d x = _mm512_loadu_pd(values + i);
+
+						const __mmask8 ordinary = _mm512_cmp_pd_mask(_mm512_abs_pd(x), infinity, _CMP_LT_OQ) & _mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_NEQ_OQ);
+						const __m512d exponent = _mm512_maskz_getexp_pd(ordinary, x);
+
+						_mm512_storeu_pd(fractions + i, _mm512_mask_getmant_pd(x, ordinary, x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src));
+						_mm256_storeu_si256(reinterpret_cast<__m256i *>(exponents + i), _mm512_maskz_cvtpd_epi32(ordinary, _mm512_add_pd(exponent, _mm512_set1_pd(1.0))));
+					}
 				}
-				else if (value == -std::numeric_limits<T>::infinity())
+
+				return i;
+			}
+
+			// the same exponent for every value if exponents is null
+			template <typename T>
+			std::size_t ldexp_avx512(const T *values, const int *exponents, int exponent, T *results, std::size_t count) noexcept
+			{
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<T, float>)
 				{
-					return -std::numeric_limits<T>::quiet_NaN();
+					// every int is near enough as a float, anything past +/-300 is already out of range
+					const __m512i same_exponent = _mm512_set1_epi32(exponent);
+
+					for (; i + 16 <= count; i += 16)
+					{
+						const __m512i n = (exponents != nullptr) ? _mm512_loadu_si512(exponents + i) : same_exponent;
+						_mm512_storeu_ps(results + i, _mm512_maskz_scalef_ps(0xFFFF, _mm512_loadu_ps(values + i), _mm512_maskz_cvtepi32_ps(0xFFFF, n)));
+					}
 				}
-				else if (value == T(0))
+				else
+				{
+					const __m256i same_exponent = _mm256_set1_epi32(exponent);
+
+					for (; i + 8 <= count; i += 8)
+					{
+						const __m256i n = (exponents != nullptr) ? _mm256_loadu_si256(reinterpret_cast<const __m256i *>(exponents + i)) : same_exponent;
+						_mm512_storeu_pd(results + i, _mm512_maskz_scalef_pd(0xFF, _mm512_loadu_pd(values + i), _mm512_maskz_cvtepi32_pd(0xFF, n)));
+					}
+				}
+
+				return i;
+			}
+
+			// vgetexp is logb(), including -infinity for zero and infinity for infinity
+			template <typename T>
+			std::size_t logb_avx512(const T *values, T *results, std::size_t count) noexcept
+			{
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<T, float>)
+				{
+					for (; i + 16 <= count; i += 16)
+						_mm512_storeu_ps(results + i, _mm512_maskz_getexp_ps(0xFFFF, _mm512_loadu_ps(values + i)));
+				}
+				else
+				{
+					for (; i + 8 <= count; i += 8)
+						_mm512_storeu_pd(results + i, _mm512_maskz_getexp_pd(0xFF, _mm512_loadu_pd(values + i)));
+				}
+
+				return i;
+			}
+
+			template <typename T>
+			std::size_t ilogb_avx512(const T *values, int *results, std::size_t count) noexcept
+			{
+				std::size_t i = 0;
+
+				if constexpr (std::is_same_v<T, float>)
 				{
-					return std::numeric_limits<T>::infinity();
+					const __m512 infinity = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+
+					for (; i + 16 <= count; i += 16)
+					{
+						const __m512 x = _mm512_loadu_ps(values + i);
+						const __m512 magnitude = _mm512_abs_ps(x);
+
+						__m512i result = _mm512_maskz_cvtps_epi32(0xFFFF, _mm512_maskz_getexp_ps(0xFFFF, x));
+						result = _mm512_mask_mov_epi32(result, _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_EQ_OQ), _mm512_set1_epi32(FP_ILOGB0));
+						result = _mm512_mask_mov_epi32(result, _mm512_cmp_ps_mask(magnitude, infinity, _CMP_EQ_OQ), _mm512_set1_epi32(std::numeric_limits<int>::max()));
+						result = _mm512_mask_mov_epi32(result, _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), _mm512_set1_epi32(FP_ILOGBNAN));
+						_mm512_storeu_si512(results + i, result);
+					}
 				}
-				else if (value < T(0))
+				else
 				{
-					return -std::numeric_limits<T>::quiet_NaN();
+					const __m512d infinity = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+
+					for (; i + 8 <= count; i += 8)
+					{
+						const __m512d x = _mm512_loadu_pd(values + i);
+						const __m512d magnitude = _mm512_abs_pd(x);
+
+						// every int is a double, so fix up the special cases before converting
+						__m512d result = _mm512_maskz_getexp_pd(0xFF, x);
+						result = _mm512_mask_mov_pd(result, _mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_EQ_OQ), _mm512_set1_pd(FP_ILOGB0));
+						result = _mm512_mask_mov_pd(result, _mm512_cmp_pd_mask(magnitude, infinity, _CMP_EQ_OQ), _mm512_set1_pd(std::numeric_limits<int>::max()));
+						result = _mm512_mask_mov_pd(result, _mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q), _mm512_set1_pd(FP_ILOGBNAN));
+						_mm256_storeu_si256(reinterpret_cast<__m256i *>(results + i), _mm512_maskz_cvtpd_epi32(0xFF, result));
+					}
 				}
 
-				return relaxed::fast_rsqrt(value);
+				return i;
 			}
 
-#if defined(_MSC_VER) || defined(__clang__)
-#pragma float_control(pop)
+CXCM_TARGET_END
 #endif
+		}	// namespace detail
 
-		} // namespace detail
-
-		//
-		// abs(), fabs()
-		//
-
-
-		// absolute value
+		// the same results as the scalar versions. when compiled for AVX-512, float and double values are done a
+		// vector at a time.
 
 		template <cxcm::concepts::basic_floating_point T>
-		constexpr T abs(T value) noexcept
+		void frexp(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> fractions, std::span<int> exponents)
 		{
-			auto new_value = cxcm::copysign(value, T(+1));
+			detail::check_sizes(values.size(), fractions.size());
+			detail::check_sizes(values.size(), exponents.size());
 
-#if !defined(NDEBUG) && defined(_MSC_VER)
-			if (isnan(new_value))
-			{
-				return detail::convert_to_quiet_nan(new_value);
-			}
-			else
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX512)
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
 			{
-				return new_value;
+				if (detail::tier_enabled(tier::avx512))
+					i = detail::frexp_avx512(values.data(), fractions.data(), exponents.data(), values.size());
 			}
-#else
-			return new_value;
 #endif
+
+			for (; i < values.size(); ++i)
+				fractions[i] = cxcm::frexp(values[i], &exponents[i]);
 		}
 
-		// don't know what to do if someone tries to negate the most negative number.
-		// standard says behavior is undefined if you can't represent the result by return type.
-		template <std::integral T>
-		constexpr T abs(T value)
+		template <cxcm::concepts::basic_floating_point T>
+		void ldexp(std::type_identity_t<std::span<const T>> values, std::span<const int> exponents, std::type_identity_t<std::span<T>> results)
 		{
-			if (value == std::numeric_limits<T>::min())
+			detail::check_sizes(values.size(), exponents.size());
+			detail::check_sizes(values.size(), results.size());
+
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX512)
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
 			{
-				throw std::domain_error("negation of min value is not a valid integral value");
+				if (detail::tier_enabled(tier::avx512))
+					i = detail::ldexp_avx512(values.data(), exponents.data(), 0, results.data(), values.size());
 			}
+#endif
 
-			[[ likely ]] return relaxed::abs(value);
+			for (; i < values.size(); ++i)
+				results[i] = cxcm::ldexp(values[i], exponents[i]);
 		}
 
+		// the same exponent for every value
 		template <cxcm::concepts::basic_floating_point T>
-		constexpr T fabs(T value) noexcept
+		void scalbn(std::type_identity_t<std::span<const T>> values, int exponent, std::type_identity_t<std::span<T>> results)
 		{
-			return cxcm::abs(value);
-		}
+			detail::check_sizes(values.size(), results.size());
 
-		template <std::integral T>
-		constexpr double fabs(T value)
-		{
-			if (value == std::numeric_limits<T>::min())
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX512)
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
 			{
-				throw std::domain_error("negation of min value is not a valid integral value");
+				if (detail::tier_enabled(tier::avx512))
+					i = detail::ldexp_avx512(values.data(), static_cast<const int *>(nullptr), exponent, results.data(), values.size());
 			}
+#endif
 
-			[[ likely ]] return relaxed::fabs(value);
+			for (; i < values.size(); ++i)
+				results[i] = cxcm::scalbn(values[i], exponent);
 		}
 
-		//
-		// trunc()
-		//
-
-		// rounds towards zero
-
 		template <cxcm::concepts::basic_floating_point T>
-		constexpr T trunc(T value) noexcept
+		void ilogb(std::type_identity_t<std::span<const T>> values, std::span<int> results)
 		{
-			if (std::is_constant_evaluated())
-			{
-				return detail::constexpr_trunc(value);
-			}
-			else
+			detail::check_sizes(values.size(), results.size());
+
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX512)
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
 			{
-				return std::trunc(value);
+				if (detail::tier_enabled(tier::avx512))
+					i = detail::ilogb_avx512(values.data(), results.data(), values.size());
 			}
-		}
+#endif
 
-		template <std::integral T>
-		constexpr double trunc(T value) noexcept
-		{
-			return trunc(static_cast<double>(value));
+			for (; i < values.size(); ++i)
+				results[i] = cxcm::ilogb(values[i]);
 		}
 
-		//
-		// floor()
-		//
-
-		// rounds towards negative infinity
-
 		template <cxcm::concepts::basic_floating_point T>
-		constexpr T floor(T value) noexcept
+		void logb(std::type_identity_t<std::span<const T>> values, std::type_identity_t<std::span<T>> results)
 		{
-			if (std::is_constant_evaluated())
-			{
-				return detail::constexpr_floor(value);
-			}
-			else
+			detail::check_sizes(values.size(), results.size());
+
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX512)
+			if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
 			{
-				return std::floor(value);
+				if (detail::tier_enabled(tier::avx512))
+					i = detail::logb_avx512(values.data(), results.data(), values.size());
 			}
-		}
+#endif
 
-		template <std::integral T>
-		constexpr double floor(T value) noexcept
-		{
-			return floor(static_cast<double>(value));
+			for (; i < values.size(); ++i)
+				results[i] = cxcm::logb(values[i]);
 		}
 
-		//
-		// ceil()
-		//
-
-		// rounds towards positive infinity
-
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T ceil(T value) noexcept
+		namespace detail
 		{
-			if (std::is_constant_evaluated())
+#if defined(CXCM_KERNELS_AVX512)
+CXCM_TARGET_AVX512_BEGIN
+
+			// 16 values at a time with vcvtps2ph/vcvtph2ps, masked forms as in frexp_avx512(). returns how many values
+			// were done.
+			inline std::size_t convert_avx512(const float *values, float16 *results, std::size_t count) noexcept
 			{
-				return detail::constexpr_ceil(value);
+				std::size_t i = 0;
+				for (; i + 16 <= count; i += 16)
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(results + i), _mm512_maskz_cvtps_ph(0xFFFF, _mm512_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+
+				return i;
 			}
-			else
+
+			inline std::size_t convert_avx512(const float16 *values, float *results, std::size_t count) noexcept
 			{
-				return std::ceil(value);
-			}
-		}
+				std::size_t i = 0;
+				for (; i + 16 <= count; i += 16)
+					_mm512_storeu_ps(results + i, _mm512_maskz_cvtph_ps(0xFFFF, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i))));
 
-		template <std::integral T>
-		constexpr double ceil(T value) noexcept
-		{
-			return ceil(static_cast<double>(value));
-		}
+				return i;
+			}
 
-		//
-		// round()
-		//
+			// integer rounding, since vcvtneps2bf16 flushes subnormals
+			inline std::size_t convert_avx512(const float *values, bfloat16 *results, std::size_t count) noexcept
+			{
+				const __m512i one = _mm512_set1_epi32(1);
+				const __m512i bias = _mm512_set1_epi32(0x7FFF);
+				const __m512i quiet = _mm512_set1_epi32(0x00400000);
 
-		// rounds to nearest integral position, halfway cases away from zero
+				std::size_t i = 0;
+				for (; i + 16 <= count; i += 16)
+				{
+					const __m512 x = _mm512_loadu_ps(values + i);
+					const __m512i bits = _mm512_castps_si512(x);
+					const __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(bias, _mm512_and_si512(_mm512_maskz_srli_epi32(0xFFFF, bits, 16), one)));
+					const __m512i result = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), rounded, _mm512_or_si512(bits, quiet));
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(results + i), _mm512_maskz_cvtepi32_epi16(0xFFFF, _mm512_maskz_srli_epi32(0xFFFF, result, 16)));
+				}
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T round(T value) noexcept
-		{
-			if (std::is_constant_evaluated())
-			{
-				return detail::constexpr_round(value);
+				return i;
 			}
-			else
+
+			inline std::size_t convert_avx512(const bfloat16 *values, float *results, std::size_t count) noexcept
 			{
-				return std::round(value);
+				std::size_t i = 0;
+				for (; i + 16 <= count; i += 16)
+				{
+					const __m512i bits = _mm512_maskz_cvtepu16_epi32(0xFFFF, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i)));
+					_mm512_storeu_ps(results + i, _mm512_castsi512_ps(_mm512_maskz_slli_epi32(0xFFFF, bits, 16)));
+				}
+
+				return i;
 			}
-		}
 
-		template <std::integral T>
-		constexpr double round(T value) noexcept
-		{
-			return round(static_cast<double>(value));
-		}
+CXCM_TARGET_END
+#endif
+#if defined(CXCM_KERNELS_F16C)
+CXCM_TARGET_AVX2_BEGIN
 
-		//
-		// fract()
-		//
+			// 8 values at a time with vcvtps2ph/vcvtph2ps. returns how many values were done.
+			inline std::size_t convert_f16c(const float *values, float16 *results, std::size_t count) noexcept
+			{
+				std::size_t i = 0;
+				for (; i + 8 <= count; i += 8)
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(results + i), _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
 
-		// there is no standard c++ version of this, so always call constexpr version
+				return i;
+			}
 
-		// the fractional part of a floating point number - always non-negative.
+			inline std::size_t convert_f16c(const float16 *values, float *results, std::size_t count) noexcept
+			{
+				std::size_t i = 0;
+				for (; i + 8 <= count; i += 8)
+					_mm256_storeu_ps(results + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i))));
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T fract(T value) noexcept
-		{
-			return detail::constexpr_fract(value);
-		}
+				return i;
+			}
 
-		template <std::integral T>
-		constexpr double fract(T value) noexcept
-		{
-			return fract(static_cast<double>(value));
-		}
+CXCM_TARGET_END
+#endif
+#if defined(CXCM_KERNELS_AVX2)
+CXCM_TARGET_AVX2_BEGIN
 
-		//
-		// fmod()
-		//
+			inline std::size_t convert_avx2(const float *values, bfloat16 *results, std::size_t count) noexcept
+			{
+				const __m256i one = _mm256_set1_epi32(1);
+				const __m256i bias = _mm256_set1_epi32(0x7FFF);
+				const __m256i quiet = _mm256_set1_epi32(0x00400000);
 
-		// the floating point remainder of division
+				std::size_t i = 0;
+				for (; i + 8 <= count; i += 8)
+				{
+					const __m256 x = _mm256_loadu_ps(values + i);
+					const __m256i bits = _mm256_castps_si256(x);
+					const __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(bias, _mm256_and_si256(_mm256_srli_epi32(bits, 16), one)));
+					const __m256i nan = _mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+					const __m256i result = _mm256_srli_epi32(_mm256_blendv_epi8(rounded, _mm256_or_si256(bits, quiet), nan), 16);
+
+					// packus works within 128-bit lanes, so gather the two useful quarters into the low half
+					const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(results + i), _mm256_castsi256_si128(packed));
+				}
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T fmod(T x, T y) noexcept
-		{
-			if (std::is_constant_evaluated())
-			{
-				return detail::constexpr_fmod(x, y);
+				return i;
 			}
-			else
+
+			inline std::size_t convert_avx2(const bfloat16 *values, float *results, std::size_t count) noexcept
 			{
-				return std::fmod(x, y);
+				std::size_t i = 0;
+				for (; i + 8 <= count; i += 8)
+				{
+					const __m256i bits = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i)));
+					_mm256_storeu_ps(results + i, _mm256_castsi256_ps(_mm256_slli_epi32(bits, 16)));
+				}
+
+				return i;
 			}
-		}
 
-		template <std::integral T>
-		constexpr double fmod(T x, T y) noexcept
-		{
-			return fmod(static_cast<double>(x), static_cast<double>(y));
-		}
+CXCM_TARGET_END
+#endif
+		}	// namespace detail
 
 		//
-		// round_even()
+		// convert() - between float and the 16-bit floating-point types
 		//
 
-		// there is no standard c++ version of this, so always call constexpr version
-
-		// rounds to nearest integral position, halfway cases towards even
+		// rounds to nearest, ties to even, the same as the scalar constructors
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T round_even(T value) noexcept
+		inline void convert(std::span<const float> values, std::span<float16> results)
 		{
-			return detail::constexpr_round_even(value);
-		}
+			detail::check_sizes(values.size(), results.size());
 
-		template <std::integral T>
-		constexpr double round_even(T value) noexcept
-		{
-			return round_even(static_cast<double>(value));
-		}
+			std::size_t i = 0;
 
-		//
-		// sqrt()
-		//
+#if defined(CXCM_KERNELS_AVX512)
+			if (detail::tier_enabled(tier::avx512))
+				i = detail::convert_avx512(values.data(), results.data(), values.size());
+#endif
+#if defined(CXCM_KERNELS_F16C)
+			if (detail::tier_enabled(tier::avx2))
+				i += detail::convert_f16c(values.data() + i, results.data() + i, values.size() - i);
+#endif
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T sqrt(T value) noexcept
-		{
-			if (std::is_constant_evaluated())
-			{
-				return detail::constexpr_sqrt(value);
-			}
-			else
-			{
-				return std::sqrt(value);
-			}
+			for (; i < values.size(); ++i)
+				results[i] = float16(values[i]);
 		}
 
-		template <std::integral T>
-		constexpr double sqrt(T value) noexcept
+		inline void convert(std::span<const float16> values, std::span<float> results)
 		{
-			return sqrt(static_cast<double>(value));
-		}
+			detail::check_sizes(values.size(), results.size());
 
-		//
-		// rsqrt() - inverse square root
-		//
+			std::size_t i = 0;
 
-		// there is no standard c++ version of this, so always call constexpr version
+#if defined(CXCM_KERNELS_AVX512)
+			if (detail::tier_enabled(tier::avx512))
+				i = detail::convert_avx512(values.data(), results.data(), values.size());
+#endif
+#if defined(CXCM_KERNELS_F16C)
+			if (detail::tier_enabled(tier::avx2))
+				i += detail::convert_f16c(values.data() + i, results.data() + i, values.size() - i);
+#endif
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T rsqrt(T value) noexcept
-		{
-			return detail::constexpr_rsqrt(value);
+			for (; i < values.size(); ++i)
+				results[i] = static_cast<float>(values[i]);
 		}
 
-		template <std::integral T>
-		constexpr double rsqrt(T value) noexcept
+		inline void convert(std::span<const float> values, std::span<bfloat16> results)
 		{
-			return rsqrt(static_cast<double>(value));
-		}
+			detail::check_sizes(values.size(), results.size());
 
-		//
-		// fast_rsqrt() - fast good approximation to inverse square root
-		//
+			std::size_t i = 0;
 
-		// there is no standard c++ version of this, so always call constexpr version
+#if defined(CXCM_KERNELS_AVX512)
+			if (detail::tier_enabled(tier::avx512))
+				i = detail::convert_avx512(values.data(), results.data(), values.size());
+#endif
+#if defined(CXCM_KERNELS_AVX2)
+			if (detail::tier_enabled(tier::avx2))
+				i += detail::convert_avx2(values.data() + i, results.data() + i, values.size() - i);
+#endif
 
-		template <cxcm::concepts::basic_floating_point T>
-		constexpr T fast_rsqrt(T value) noexcept
-		{
-			return detail::constexpr_fast_rsqrt(value);
+			for (; i < values.size(); ++i)
+				results[i] = bfloat16(values[i]);
 		}
 
-		template <std::integral T>
-		constexpr double fast_rsqrt(T value) noexcept
+		inline void convert(std::span<const bfloat16> values, std::span<float> results)
 		{
-			return fast_rsqrt(static_cast<double>(value));
+			detail::check_sizes(values.size(), results.size());
+
+			std::size_t i = 0;
+
+#if defined(CXCM_KERNELS_AVX512)
+			if (detail::tier_enabled(tier::avx512))
+				i = detail::convert_avx512(values.data(), results.data(), values.size());
+#endif
+#if defined(CXCM_KERNELS_AVX2)
+			if (detail::tier_enabled(tier::avx2))
+				i += detail::convert_avx2(values.data() + i, results.data() + i, values.size() - i);
+#endif
+
+			for (; i < values.size(); ++i)
+				results[i] = static_cast<float>(values[i]);
 		}
 
-	} // namespace strict
+	} // namespace batch
 
 } // namespace cxcm
 
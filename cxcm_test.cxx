@@ -7,6 +7,12 @@
 #include "cxcm.hxx"
 #include <numbers>
 #include <climits>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <memory>
+#include <numeric>
 
 
 #if defined(__clang__)
@@ -17,6 +23,34 @@
 #include "doctest.h"
 
 
+// approx<Bits> results worked out at compile time, and how many of them the runtime results don't match bit for bit
+template <typename T, auto Approximation>
+int approx_runtime_mismatches()
+{
+	using bits_type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+	constexpr std::size_t count = 64;
+
+	constexpr auto table = []() consteval
+	{
+		std::array<T, count> results{};
+		for (std::size_t i = 0; i < count; ++i)
+			results[i] = Approximation(static_cast<T>(3 * i + 1) / 5);
+
+		return results;
+	}();
+
+	int mismatches = 0;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		// volatile, so the compiler can't work these out at compile time too
+		volatile T value = static_cast<T>(3 * i + 1) / 5;
+		if (std::bit_cast<bits_type>(Approximation(value)) != std::bit_cast<bits_type>(table[i]))
+			++mismatches;
+	}
+
+	return mismatches;
+}
+
 TEST_SUITE("constexpr_math for double")
 {
 	TEST_CASE("testing fidelity of cxcm::fabs() with std::fabs() for double values")
@@ -603,6 +637,245 @@ TEST_SUITE("constexpr_math for double")
 		CHECK(cxcm::round_even(3.5) == 4);
 	}
 
+	TEST_CASE("testing cxcm::lround(), cxcm::lrint(), cxcm::ifloor(), cxcm::iceil(), cxcm::itrunc() double values")
+	{
+		static_assert(cxcm::ifloor(-0.5) == -1);
+		static_assert(cxcm::iceil(-0.5) == 0);
+		static_assert(cxcm::itrunc(-1.5) == -1);
+		static_assert(cxcm::lround(-2.5) == -3l);
+		static_assert(cxcm::lrint(-2.5) == -2l);
+		static_assert(cxcm::llrint(3.5) == 4ll);
+
+		// saturation
+		constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+		constexpr double inf = std::numeric_limits<double>::infinity();
+		static_assert(cxcm::ifloor(nan) == 0);
+		static_assert(cxcm::ifloor(inf) == std::numeric_limits<int>::max());
+		static_assert(cxcm::ifloor(-inf) == std::numeric_limits<int>::min());
+		static_assert(cxcm::iceil(2147483647.5) == std::numeric_limits<int>::max());
+		static_assert(cxcm::llround(0x1.0p63) == std::numeric_limits<long long>::max());
+		static_assert(cxcm::itrunc<unsigned int>(-3.0) == 0u);
+		static_assert(cxcm::iceil<std::int8_t>(127.5f) == 127);
+
+		for (double x : {-2.5, -1.5, -0.5, -0.25, 0.0, 0.25, 0.5, 1.5, 2.5, 1e9 + 0.5, -1e15 - 0.5})
+		{
+			CHECK_EQ(cxcm::lround(x), std::lround(x));
+			CHECK_EQ(cxcm::llrint(x), std::llrint(x));
+			CHECK_EQ(cxcm::ifloor<long long>(x), static_cast<long long>(std::floor(x)));
+			CHECK_EQ(cxcm::iceil<long long>(x), static_cast<long long>(std::ceil(x)));
+			CHECK_EQ(cxcm::itrunc<long long>(x), static_cast<long long>(std::trunc(x)));
+		}
+
+		// every vector width and the scalar remainder
+		std::vector<double> values(103);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			values[i] = (static_cast<double>(i) - 51.0) * 0.37e8;
+		values[1] = nan;
+		values[2] = inf;
+		values[3] = -inf;
+		values[4] = 2147483647.5;
+
+		std::vector<int> cells(values.size());
+		std::vector<long long> wide_cells(values.size());
+		cxcm::batch::ifloor<int, double>(values, cells);
+		cxcm::batch::iceil<long long, double>(values, wide_cells);
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			CHECK_EQ(cells[i], cxcm::ifloor(values[i]));
+			CHECK_EQ(wide_cells[i], cxcm::iceil<long long>(values[i]));
+		}
+
+		std::vector<float> float_values(values.begin(), values.end());
+		cxcm::batch::itrunc<int, float>(float_values, cells);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			CHECK_EQ(cells[i], cxcm::itrunc(float_values[i]));
+	}
+
+	TEST_CASE("testing cxcm::frexp(), cxcm::ldexp(), cxcm::ilogb(), cxcm::logb(), cxcm::nextafter() double values")
+	{
+		constexpr double denorm_min = std::numeric_limits<double>::denorm_min();
+		constexpr double inf = std::numeric_limits<double>::infinity();
+
+		constexpr auto split = [](double value)
+		{
+			int exponent = 0;
+			double fraction = cxcm::frexp(value, &exponent);
+
+			return std::pair{fraction, exponent};
+		};
+
+		static_assert(split(8.0) == std::pair{0.5, 4});
+		static_assert(split(-0.75) == std::pair{-0.75, 0});
+		static_assert(split(denorm_min) == std::pair{0.5, -1073});
+		static_assert(split(0.0) == std::pair{0.0, 0});
+
+		static_assert(cxcm::ldexp(0.75, 3) == 6.0);
+		static_assert(cxcm::ldexp(1.0, -1074) == denorm_min);
+		static_assert(cxcm::ldexp(1.0, 1024) == inf);
+		static_assert(cxcm::ldexp(1.5, -1074) == 2 * denorm_min);
+		static_assert(cxcm::ldexp(0.5, -1074) == 0.0);
+		static_assert(cxcm::scalbn(3.0, -1) == 1.5);
+		static_assert(cxcm::ldexp(0x1.0p-149f, 100) == 0x1.0p-49f);
+
+		static_assert(cxcm::ilogb(denorm_min) == -1074);
+		static_assert(cxcm::ilogb(0.0) == FP_ILOGB0);
+		static_assert(cxcm::ilogb(inf) == std::numeric_limits<int>::max());
+		static_assert(cxcm::logb(-0.1) == -4.0);
+		static_assert(cxcm::logb(0.0) == -inf);
+
+		static_assert(cxcm::nextafter(1.0, 2.0) == 1.0 + std::numeric_limits<double>::epsilon());
+		static_assert(cxcm::nextafter(0.0, -1.0) == -denorm_min);
+		static_assert(cxcm::nextafter(std::numeric_limits<double>::min(), 0.0) == std::numeric_limits<double>::min() - denorm_min);
+		static_assert(cxcm::nextafter(inf, 0.0) == std::numeric_limits<double>::max());
+		static_assert(cxcm::nexttoward(1.0f, 2.0L) == 1.0f + std::numeric_limits<float>::epsilon());
+		static_assert(cxcm::nexttoward(1.0L, 0.0L) == 1.0L - std::numeric_limits<long double>::epsilon() / 2);
+
+		std::vector<double> values(37);
+		std::vector<int> exponents(values.size());
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			values[i] = (static_cast<double>(i) - 18.0) * 1.0e-310 * static_cast<double>(i * i);
+			exponents[i] = static_cast<int>(i) * 97 - 1800;
+		}
+		values[1] = inf;
+		values[2] = std::numeric_limits<double>::quiet_NaN();
+
+		std::vector<double> fractions(values.size());
+		std::vector<double> results(values.size());
+		std::vector<int> logs(values.size());
+		cxcm::batch::frexp<double>(values, fractions, logs);
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			int exponent = 0;
+			double fraction = std::frexp(values[i], &exponent);
+			CHECK_EQ(std::bit_cast<std::uint64_t>(fractions[i]), std::bit_cast<std::uint64_t>(fraction));
+			if (std::isfinite(values[i]))
+				CHECK_EQ(logs[i], exponent);
+		}
+
+		cxcm::batch::ldexp<double>(values, exponents, results);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			CHECK_EQ(std::bit_cast<std::uint64_t>(results[i]), std::bit_cast<std::uint64_t>(std::ldexp(values[i], exponents[i])));
+
+		cxcm::batch::ilogb<double>(values, logs);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			CHECK_EQ(logs[i], std::ilogb(values[i]));
+	}
+
+	TEST_CASE("testing cxcm::fmod(), cxcm::remainder(), cxcm::remquo() double values")
+	{
+		constexpr double denorm_min = std::numeric_limits<double>::denorm_min();
+
+		static_assert(cxcm::fmod(5.5, 2.0) == 1.5);
+		static_assert(cxcm::fmod(-5.5, 2.0) == -1.5);
+		static_assert(cxcm::remainder(5.5, 2.0) == -0.5);
+		static_assert(cxcm::remainder(6.5, 2.0) == 0.5);
+		static_assert(cxcm::remainder(3.0, 2.0) == -1.0);
+		static_assert(cxcm::remainder(5.0, 2.0) == 1.0);
+		static_assert(cxcm::fmod(0x1.0p-1022, 3 * denorm_min) == denorm_min);
+
+		constexpr auto quotient = [](double x, double y)
+		{
+			int n = 0;
+			double r = cxcm::remquo(x, y, &n);
+
+			return std::pair{r, n};
+		};
+
+		static_assert(quotient(7.0, 2.0) == std::pair{-1.0, 4});
+		static_assert(quotient(-7.0, 2.0) == std::pair{1.0, -4});
+
+		// huge quotients are exact in constant evaluation too
+		constexpr double big_fmod = cxcm::fmod(1.0e300, 3.0);
+		constexpr double big_remainder = cxcm::remainder(-0x1.fffffffffffffp1023, 0.1);
+		constexpr auto big_quotient = quotient(1.0e300, 7.0);
+		CHECK_EQ(big_fmod, std::fmod(1.0e300, 3.0));
+		CHECK_EQ(big_remainder, std::remainder(-0x1.fffffffffffffp1023, 0.1));
+
+		int n = 0;
+		CHECK_EQ(big_quotient.first, std::remquo(1.0e300, 7.0, &n));
+		CHECK_EQ(big_quotient.second & 7, n & 7);
+
+		std::vector<double> values(45);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			values[i] = (static_cast<double>(i) - 22.0) * 1.37 * static_cast<double>(i * i * i);
+		values[1] = std::numeric_limits<double>::infinity();
+		values[2] = std::numeric_limits<double>::quiet_NaN();
+		values[3] = 1.0e300;
+		values[4] = -0.0;
+
+		std::vector<double> results(values.size());
+		for (double divisor : {2.5, -0.1, 6.283185307179586, 1.0e-300, 0.0})
+		{
+			cxcm::batch::fmod<double>(values, divisor, results);
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				double expected = std::fmod(values[i], divisor);
+				if (std::isnan(expected))
+					CHECK(std::isnan(results[i]));
+				else
+					CHECK_EQ(std::bit_cast<std::uint64_t>(results[i]), std::bit_cast<std::uint64_t>(expected));
+			}
+		}
+	}
+
+	TEST_CASE("testing cxcm::periodic double values")
+	{
+		constexpr double pi = 3.141592653589793;
+		constexpr auto angles = cxcm::make_periodic(-pi, pi);
+
+		static_assert(angles.contains(-pi) && !angles.contains(pi));
+		static_assert(angles.wrap(pi) == -pi);
+		static_assert(angles.wrap(-9 * pi) == -pi);
+		static_assert(angles.wrap(0.5) == 0.5);
+		static_assert(angles.distance(3.0, -3.0) == (2 * pi - 6.0));
+		static_assert(angles.distance(0.0, pi) == -pi);
+		static_assert(angles.nearest_representative(-3.0, 3.0) == -3.0 + 2 * pi);
+
+		constexpr auto degrees = cxcm::make_periodic(0.0f, 360.0f);
+		static_assert(degrees.wrap(-30.0f) == 330.0f);
+		static_assert(degrees.wrap(-0x1.0p-30f) == 0.0f);
+		static_assert(degrees.wrap(360.0f * 1000) == 0.0f);
+		static_assert(degrees.distance(350.0f, 10.0f) == 20.0f);
+
+		CHECK_THROWS_AS(cxcm::make_periodic(1.0, 1.0), std::domain_error);
+		CHECK_THROWS_AS(cxcm::make_periodic(-0.1, 0.5), std::domain_error);
+
+		std::vector<double> values(45);
+		std::vector<double> references(values.size());
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			values[i] = (static_cast<double>(i) - 22.0) * 1.37 * static_cast<double>(i * i * i);
+			references[i] = static_cast<double>(i) * 0.3 - 7.0;
+		}
+		values[1] = std::numeric_limits<double>::infinity();
+		values[2] = 1.0e300;
+		values[3] = 8 * pi;
+
+		std::vector<double> results(values.size());
+		cxcm::batch::wrap<double>(angles, values, results);
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if (std::isfinite(values[i]))
+			{
+				CHECK(angles.contains(results[i]));
+				CHECK_EQ(results[i], angles.wrap(values[i]));
+			}
+			else
+			{
+				CHECK(std::isnan(results[i]));
+			}
+		}
+		CHECK_EQ(results[3], 0.0);
+
+		cxcm::batch::distance<double>(angles, references, values, results);
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if (std::isfinite(values[i]))
+				CHECK_EQ(results[i], angles.distance(references[i], values[i]));
+		}
+	}
+
 	TEST_CASE("constexpr sqrt() and rsqrt() for double")
 	{
 		CHECK_EQ(std::numbers::sqrt2_v<double>, cxcm::sqrt(2.0));
@@ -612,6 +885,459 @@ TEST_SUITE("constexpr_math for double")
 		CHECK_EQ(std::numbers::inv_sqrt3_v<double>, cxcm::rsqrt(3.0));
 		CHECK_EQ(std::numbers::inv_sqrtpi_v<double>, cxcm::rsqrt(std::numbers::pi_v<double>));
 	}
+
+	TEST_CASE("testing cxcm::detail::integer_sqrt() double and float values")
+	{
+		static_assert(cxcm::detail::integer_sqrt(2.0) == std::numbers::sqrt2_v<double>);
+		static_assert(cxcm::detail::integer_sqrt(3.0f) == std::numbers::sqrt3_v<float>);
+		static_assert(cxcm::detail::integer_sqrt(0x1.0p-1074) == 0x1.0p-537);
+		static_assert(cxcm::detail::integer_sqrt(0x1.0p-149f) == 0x1.6a09e6p-75f);
+		static_assert(cxcm::detail::integer_sqrt(std::numeric_limits<double>::max()) == 0x1.fffffffffffffp+511);
+
+		std::mt19937_64 generator(36);
+		for (int i = 0; i < 10000; ++i)
+		{
+			double value = std::bit_cast<double>(generator() % 0x7FF0000000000000ull);
+			float float_value = std::bit_cast<float>(static_cast<std::uint32_t>(generator() % 0x7F800000u));
+			if (value > 0.0)
+				CHECK_EQ(std::sqrt(value), cxcm::detail::integer_sqrt(value));
+			if (float_value > 0.0f)
+				CHECK_EQ(std::sqrt(float_value), cxcm::detail::integer_sqrt(float_value));
+		}
+	}
+
+	TEST_CASE("testing constant evaluation against the cxcm algorithms double values")
+	{
+		// in constant evaluation, trunc(), floor(), ceil(), round(), fmod(), and sqrt() go to a constexpr <cmath> or
+		// gcc's builtins when they can. they have to give the bits of the cxcm algorithms, which these run directly.
+		// build with and without CXCM_NO_CONSTEXPR_BUILTINS to check both ways.
+		constexpr auto same_bits = [](double a, double b) { return std::bit_cast<std::uint64_t>(a) == std::bit_cast<std::uint64_t>(b); };
+		constexpr auto next_up = [](double value) { return std::bit_cast<double>(std::bit_cast<std::uint64_t>(value) + 1); };
+		constexpr auto next_down = [](double value) { return std::bit_cast<double>(std::bit_cast<std::uint64_t>(value) - 1); };
+
+		static constexpr std::array<double, 21> values = {-0.5, -0.4, -0.0, 0.0, 0.4, 0.5, -1.5, 2.5, -2.5, 0.49999999999999994,
+														  -0.49999999999999994, 4503599627370495.5, -4503599627370495.5, 1.0e300, -1.0e300,
+														  std::numeric_limits<double>::min(), -std::numeric_limits<double>::denorm_min(),
+														  123.456, -123.456, -0x1.0p-1000, 0x1.fffffffffffffp-1};
+
+		constexpr auto all_same = [=](auto routed, auto algorithm)
+		{
+			for (double value : values)
+			{
+				if (!same_bits(routed(value), algorithm(value)))
+					return false;
+			}
+
+			return true;
+		};
+
+		static_assert(all_same([](double x) { return cxcm::trunc(x); }, [](double x) { return cxcm::detail::constexpr_trunc(x); }));
+		static_assert(all_same([](double x) { return cxcm::floor(x); }, [](double x) { return cxcm::detail::constexpr_floor(x); }));
+		static_assert(all_same([](double x) { return cxcm::ceil(x); }, [](double x) { return cxcm::detail::constexpr_ceil(x); }));
+		static_assert(all_same([](double x) { return cxcm::round(x); }, [](double x) { return cxcm::detail::constexpr_round(x); }));
+
+		// negative values that round to zero give +0, and zero keeps its sign
+		static_assert(!cxcm::signbit(cxcm::trunc(-0.5)));
+		static_assert(!cxcm::signbit(cxcm::ceil(-0.5)));
+		static_assert(!cxcm::signbit(cxcm::round(-0.4)));
+		static_assert(cxcm::signbit(cxcm::trunc(-0.0)));
+		static_assert(cxcm::signbit(cxcm::floor(-0.0)));
+		static_assert(cxcm::floor(-0.4) == -1.0);
+
+		// fmod(), where a zero result has the sign of x
+		constexpr auto same_fmod = [=](double x, double y) { return same_bits(cxcm::fmod(x, y), cxcm::detail::constexpr_fmod(x, y)); };
+		static_assert(same_fmod(5.5, 2.0) && same_fmod(-5.5, 2.0) && same_fmod(-4.0, 2.0) && same_fmod(4.0, -2.0));
+		static_assert(same_fmod(-0.0, 3.0) && same_fmod(7.0, 0.1) && same_fmod(1.0e300, 3.0) && same_fmod(-0x1.fffffffffffffp1023, 0.1));
+		static_assert(same_fmod(0x1.0p-1022, 3 * std::numeric_limits<double>::denorm_min()) && same_fmod(1.0, 0x1.0p-1074));
+		static_assert(cxcm::signbit(cxcm::fmod(-4.0, 2.0)));
+
+		// sqrt() of the powers of 4 and their neighbours, where the root crosses a power of 2, for both sqrt algorithms
+		constexpr auto same_sqrt = [=](double value)
+		{
+			return same_bits(cxcm::sqrt(value), cxcm::detail::constexpr_sqrt(value)) &&
+				   same_bits(cxcm::sqrt(value), cxcm::detail::integer_sqrt(value));
+		};
+
+		constexpr auto powers_of_4 = [=](int low, int high)
+		{
+			for (int power = low; power <= high; power += 2)
+			{
+				const double value = (power < 0) ? 1.0 / static_cast<double>(1ull << -power) : static_cast<double>(1ull << power);
+				if (!same_sqrt(next_down(value)) || !same_sqrt(value) || !same_sqrt(next_up(value)))
+					return false;
+			}
+
+			return true;
+		};
+
+		static_assert(powers_of_4(-62, 62));
+		static_assert(same_sqrt(0x1.0p-1022) && same_sqrt(next_up(0x1.0p-1022)) && same_sqrt(0x1.0p1022) && same_sqrt(next_down(0x1.0p1022)));
+		static_assert(same_bits(cxcm::sqrt(-0.0), cxcm::detail::constexpr_sqrt(-0.0)));
+	}
+
+	TEST_CASE("testing cxcm::horner(), cxcm::estrin(), cxcm::comp_horner() double values")
+	{
+		// 1 + 2x + 3x^2 + 4x^3 + 5x^4
+		constexpr std::array<double, 5> coefficients = {1.0, 2.0, 3.0, 4.0, 5.0};
+
+		static_assert(cxcm::horner(coefficients, 2.0) == 129.0);
+		static_assert(cxcm::estrin(coefficients, 2.0) == 129.0);
+		static_assert(cxcm::comp_horner(coefficients, 2.0) == 129.0);
+		static_assert(cxcm::horner(std::array<double, 0>{}, 2.0) == 0.0);
+		static_assert(cxcm::estrin(std::array<double, 1>{7.0}, 2.0) == 7.0);
+		static_assert(cxcm::estrin(std::array<double, 6>{1.0, 1.0, 1.0, 1.0, 1.0, 1.0}, 2.0) == 63.0);
+
+		// (x - 0.75)^5, evaluated near its root
+		constexpr std::array<double, 6> near_root = {-0.2373046875, 1.58203125, -4.21875, 5.625, -3.75, 1.0};
+		constexpr double x = 0.75 + 0x1.0p-12;
+		constexpr double exact = 0x1.0p-60;
+
+		constexpr double compensated = cxcm::comp_horner(near_root, x);
+		static_assert(cxcm::relaxed::abs(compensated - exact) < 0x1.0p-100);
+		CHECK(cxcm::relaxed::abs(cxcm::horner(near_root, x) - exact) >= exact);
+
+		// batch versions
+		std::vector<double> values;
+		for (int i = 0; i < 37; ++i)
+			values.push_back(x + i * 0x1.0p-20);
+
+		std::vector<double> results(values.size());
+		cxcm::batch::comp_horner(near_root, values, results);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			CHECK(results[i] == cxcm::comp_horner(near_root, values[i]));
+
+		cxcm::batch::horner(coefficients, values, results);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			CHECK(results[i] == doctest::Approx(cxcm::horner(coefficients, values[i])));
+
+		// estrin's pairs in the scalar order, so the same bits
+		cxcm::batch::estrin(coefficients, values, results);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			CHECK(std::bit_cast<std::uint64_t>(results[i]) == std::bit_cast<std::uint64_t>(cxcm::estrin(coefficients, values[i])));
+
+		const std::array<double, 7> odd_count = {0.5, -1.25, 0.375, 2.0, -0.0625, 1.5, -0.75};
+		cxcm::batch::estrin(odd_count, values, results);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			CHECK(std::bit_cast<std::uint64_t>(results[i]) == std::bit_cast<std::uint64_t>(cxcm::estrin(odd_count, values[i])));
+
+		std::vector<double> too_few_results(values.size() - 1);
+		CHECK_THROWS_AS(cxcm::batch::horner(coefficients, values, too_few_results), std::length_error);
+	}
+
+	TEST_CASE("testing cxcm::remez() double values")
+	{
+		// the minimax quadratic for x^3 on [-1, 1] is 3x/4, from the chebyshev polynomial T3
+		constexpr auto cubic = cxcm::remez<2>([](double x) { return x * x * x; }, -1.0, 1.0);
+		CHECK(cubic[0] == doctest::Approx(0.0));
+		CHECK(cubic[1] == doctest::Approx(0.75));
+		CHECK(cubic[2] == doctest::Approx(0.0));
+
+		// the error of a minimax fit equioscillates, so its extremes are level
+		constexpr auto root = cxcm::remez<5>([](double x) { return cxcm::sqrt(x); }, 1.0, 2.0);
+
+		double smallest_error = 0.0;
+		double largest_error = 0.0;
+		for (int i = 0; i <= 10000; ++i)
+		{
+			const double x = 1.0 + i / 10000.0;
+			const double error = cxcm::horner(root, x) - std::sqrt(x);
+			smallest_error = std::min(smallest_error, error);
+			largest_error = std::max(largest_error, error);
+		}
+
+		CHECK(largest_error < 2.0e-6);
+		CHECK(-smallest_error == doctest::Approx(largest_error).epsilon(0.01));
+	}
+
+	TEST_CASE("testing cxcm::make_table() double values")
+	{
+		constexpr auto root = [](double x) { return cxcm::sqrt(x); };
+		constexpr auto table = cxcm::make_table<256>(root, 1.0, 4.0);
+
+		// exact at the nodes
+		static_assert(table.nearest(1.0) == 1.0);
+		static_assert(table.linear(4.0) == 2.0);
+		static_assert(table.cubic(4.0) == 2.0);
+		static_assert(table.cubic(1.0) == 1.0);
+
+		// clamped outside the interval
+		static_assert(table(0.0, cxcm::interpolation::linear) == 1.0);
+		static_assert(table(100.0, cxcm::interpolation::cubic) == 2.0);
+		CHECK(cxcm::isnan(table(std::numeric_limits<double>::quiet_NaN())));
+
+		// error against the exact function
+		const double nearest_error = table.max_error(root, cxcm::interpolation::nearest);
+		const double linear_error = table.max_error(root, cxcm::interpolation::linear);
+		const double cubic_error = table.max_error(root, cxcm::interpolation::cubic);
+
+		CHECK(nearest_error < 3.0e-3);
+		CHECK(linear_error < 5.0e-6);
+		CHECK(cubic_error < 1.0e-9);
+
+		// batch version
+		std::vector<double> values;
+		for (int i = -10; i < 1000; ++i)
+			values.push_back(1.0 + i * 0.00317);
+		values.push_back(std::numeric_limits<double>::quiet_NaN());
+
+		std::vector<double> results(values.size());
+		for (auto method : {cxcm::interpolation::nearest, cxcm::interpolation::linear, cxcm::interpolation::cubic})
+		{
+			cxcm::batch::lookup(table, method, values, results);
+			for (std::size_t i = 0; i < values.size() - 1; ++i)
+				CHECK(results[i] == doctest::Approx(table(values[i], method)).epsilon(1.0e-15));
+
+			CHECK(cxcm::isnan(results.back()));
+		}
+	}
+
+	TEST_CASE("testing cxcm::reproducible_sum() double values")
+	{
+		// constexpr
+		constexpr std::array<double, 10> tenths = {0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1, 0.1};
+		static_assert(cxcm::reproducible_sum(tenths) == 1.0);
+
+		constexpr std::array<double, 0> nothing = {};
+		static_assert(cxcm::reproducible_sum(nothing) == 0.0);
+
+		// special values
+		CHECK(cxcm::isnan(cxcm::reproducible_sum(std::array{1.0, std::numeric_limits<double>::quiet_NaN()})));
+		CHECK(cxcm::isnan(cxcm::reproducible_sum(std::array{std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()})));
+		CHECK(cxcm::reproducible_sum(std::array{1.0, -std::numeric_limits<double>::infinity()}) == -std::numeric_limits<double>::infinity());
+
+		// values big enough that the boundaries have to be scaled
+		CHECK(cxcm::reproducible_sum(std::array{std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(), 1.0}) == 0.0);
+		CHECK(cxcm::reproducible_sum(std::array{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()}) == std::numeric_limits<double>::infinity());
+
+		// subnormals
+		CHECK(cxcm::reproducible_sum(std::array{std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::denorm_min()}) == 2 * std::numeric_limits<double>::denorm_min());
+
+		// same bits regardless of order and thread count
+		std::vector<double> values;
+		unsigned long long state = 0x2545F4914F6CDD1DULL;
+		for (int i = 0; i < 100000; ++i)
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			values.push_back(std::ldexp(static_cast<double>(static_cast<long long>(state)), static_cast<int>(state % 64) - 96));
+		}
+
+		const double serial_sum = cxcm::reproducible_sum(values);
+		CHECK(serial_sum == cxcm::reproducible_sum(values, 1));
+		CHECK(serial_sum == cxcm::reproducible_sum(values, 3));
+		CHECK(serial_sum == cxcm::reproducible_sum(values, 4));
+
+		std::reverse(values.begin(), values.end());
+		CHECK(serial_sum == cxcm::reproducible_sum(values));
+		CHECK(serial_sum == cxcm::reproducible_sum(values, 5));
+
+		std::sort(values.begin(), values.end());
+		CHECK(serial_sum == cxcm::reproducible_sum(values));
+		CHECK(serial_sum == cxcm::reproducible_sum(values, 2));
+	}
+
+	TEST_CASE("testing cxcm::approx double values")
+	{
+		static_assert(cxcm::approx<40>::exp2(-3.0) == 0.125);
+		static_assert(cxcm::approx<40>::log2(1024.0) == 10.0);
+
+		// the same bits at compile time as at runtime, fma or not
+		CHECK(approx_runtime_mismatches<double, [](double x) { return cxcm::approx<30>::sqrt(x); }>() == 0);
+		CHECK(approx_runtime_mismatches<double, [](double x) { return cxcm::approx<49>::rsqrt(x); }>() == 0);
+		CHECK(approx_runtime_mismatches<double, [](double x) { return cxcm::approx<40>::recip(-x); }>() == 0);
+		CHECK(approx_runtime_mismatches<double, [](double x) { return cxcm::approx<49>::exp2(x); }>() == 0);
+		CHECK(approx_runtime_mismatches<double, [](double x) { return cxcm::approx<40>::exp2(-x); }>() == 0);
+		CHECK(approx_runtime_mismatches<double, [](double x) { return cxcm::approx<49>::log2(x); }>() == 0);
+	}
+
+	TEST_CASE("testing cxcm::batch rounding, sqrt, and classification double values")
+	{
+		// the largest double below one half, where adding 0.5 rounds up
+		static_assert(cxcm::round(0.49999999999999994) == 0.0);
+		static_assert(cxcm::round_even(0.49999999999999994) == 0.0);
+		static_assert(cxcm::round_even(-2.5) == -2.0);
+		static_assert(cxcm::rsqrt(0x1.0p-1070) == 0x1.0p+535);
+
+		std::vector<double> values;
+		for (int i = -1000; i <= 1000; ++i)
+			values.push_back(static_cast<double>(i) * 0.25 + 0.001 * (i % 3));
+
+		for (double edge : {0.0, -0.0, 0.49999999999999994, -0.49999999999999994, 4503599627370495.5, -4503599627370497.0, 1.0e300,
+							std::numeric_limits<double>::min(), std::numeric_limits<double>::denorm_min(), -std::numeric_limits<double>::denorm_min(),
+							std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()})
+			values.push_back(edge);
+
+		// whichever kernels run, the results are the scalar ones, bit for bit
+		std::vector<double> results(values.size());
+		auto mismatches = [&](auto batch_function, auto scalar_function)
+		{
+			batch_function(values, results);
+
+			int count = 0;
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				if (std::bit_cast<unsigned long long>(results[i]) != std::bit_cast<unsigned long long>(scalar_function(values[i])))
+					++count;
+			}
+
+			return count;
+		};
+
+		CHECK(mismatches(cxcm::batch::floor<double>, [](double x) { return cxcm::floor(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::ceil<double>, [](double x) { return cxcm::ceil(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::trunc<double>, [](double x) { return cxcm::trunc(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::round<double>, [](double x) { return cxcm::round(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::round_even<double>, [](double x) { return cxcm::round_even(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::fract<double>, [](double x) { return cxcm::fract(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::sqrt<double>, [](double x) { return cxcm::sqrt(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::rsqrt<double>, [](double x) { return cxcm::rsqrt(x); }) == 0);
+
+		std::vector<int> classes(values.size());
+		std::unique_ptr<bool[]> nans(new bool[values.size()]);
+		std::unique_ptr<bool[]> normals(new bool[values.size()]);
+		std::unique_ptr<bool[]> signs(new bool[values.size()]);
+		cxcm::batch::fpclassify<double>(values, classes);
+		cxcm::batch::isnan<double>(values, std::span(nans.get(), values.size()));
+		cxcm::batch::isnormal<double>(values, std::span(normals.get(), values.size()));
+		cxcm::batch::signbit<double>(values, std::span(signs.get(), values.size()));
+
+		int class_mismatches = 0;
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if ((classes[i] != cxcm::fpclassify(values[i])) || (nans[i] != cxcm::isnan(values[i])) ||
+				(normals[i] != cxcm::isnormal(values[i])) || (signs[i] != cxcm::signbit(values[i])))
+				++class_mismatches;
+		}
+
+		CHECK(class_mismatches == 0);
+	}
+
+	TEST_CASE("testing cxcm policies double values")
+	{
+		static_assert(cxcm::floor<cxcm::strict_policy>(-2.5) == -3.0);
+		static_assert(cxcm::floor<cxcm::relaxed_policy>(-2.5) == -3.0);
+		static_assert(cxcm::round_even<cxcm::fast_policy>(2.5) == 2.0);
+		static_assert(cxcm::round_even<cxcm::reproducible_policy>(-2.5) == -2.0);
+		static_assert(cxcm::fract<cxcm::reproducible_policy>(-0.25) == 0.75);
+		static_assert(cxcm::sqrt<cxcm::fast_policy>(2.25) == 1.5);
+		static_assert(cxcm::rsqrt<cxcm::relaxed_policy>(0.25) == 2.0);
+		static_assert(cxcm::fmod<cxcm::reproducible_policy>(7.5, 2.0) == 1.5);
+
+		std::vector<double> values;
+		for (int i = -1000; i <= 1000; ++i)
+			values.push_back(static_cast<double>(i) * 0.375 + 0.001 * (i % 7));
+
+		for (double edge : {0.0, -0.0, 4503599627370495.5, 1.0e300, std::numeric_limits<double>::denorm_min(),
+							std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()})
+			values.push_back(edge);
+
+		// reproducible gives the constexpr bits at runtime, including for the special values
+		auto reproducible = [&](auto policy_function, auto constexpr_function)
+		{
+			int count = 0;
+			for (double value : values)
+			{
+				if (std::bit_cast<unsigned long long>(policy_function(value)) != std::bit_cast<unsigned long long>(constexpr_function(value)))
+					++count;
+			}
+
+			return count;
+		};
+
+		CHECK(reproducible([](double x) { return cxcm::floor<cxcm::reproducible_policy>(x); }, [](double x) { return cxcm::strict::detail::constexpr_floor(x); }) == 0);
+		CHECK(reproducible([](double x) { return cxcm::round<cxcm::reproducible_policy>(x); }, [](double x) { return cxcm::strict::detail::constexpr_round(x); }) == 0);
+		CHECK(reproducible([](double x) { return cxcm::sqrt<cxcm::reproducible_policy>(x); }, [](double x) { return cxcm::strict::detail::constexpr_sqrt(x); }) == 0);
+
+		// the batch versions give the scalar results for the same policy
+		std::vector<double> results(values.size());
+		auto mismatches = [&](auto batch_function, auto scalar_function)
+		{
+			batch_function(values, results);
+
+			int count = 0;
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				if (std::bit_cast<unsigned long long>(results[i]) != std::bit_cast<unsigned long long>(scalar_function(values[i])))
+					++count;
+			}
+
+			return count;
+		};
+
+		CHECK(mismatches(cxcm::batch::floor<cxcm::reproducible_policy, double>, [](double x) { return cxcm::floor<cxcm::reproducible_policy>(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::round_even<cxcm::reproducible_policy, double>, [](double x) { return cxcm::round_even<cxcm::reproducible_policy>(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::sqrt<cxcm::reproducible_policy, double>, [](double x) { return cxcm::sqrt<cxcm::reproducible_policy>(x); }) == 0);
+
+		// relaxed only promises its results for finite values small enough to have a fraction
+		values.resize(2001);
+		results.resize(2001);
+		CHECK(mismatches(cxcm::batch::trunc<cxcm::relaxed_policy, double>, [](double x) { return cxcm::trunc<cxcm::relaxed_policy>(x); }) == 0);
+		CHECK(mismatches(cxcm::batch::fract<cxcm::fast_policy, double>, [](double x) { return cxcm::fract<cxcm::fast_policy>(x); }) == 0);
+	}
+
+	TEST_CASE("testing cxcm::reproducible_policy runtime double values")
+	{
+		// constexpr_sqrt() is correctly rounded, even where the exact root is within 2^-106 of halfway
+		static_assert(cxcm::detail::constexpr_sqrt(4503599627370495.5) == 0x1.fffffffffffffp+25);
+		static_assert(cxcm::detail::constexpr_sqrt(0x1.fffffffffffffp+1023) == 0x1.fffffffffffffp+511);
+
+		std::mt19937_64 generator(49);
+		std::vector<double> values;
+		for (int i = 0; i < 100000; ++i)
+			values.push_back(std::bit_cast<double>(generator()));
+
+		// values in the range that has fractions, and next to powers of 4 and squares
+		for (int i = 0; i < 20000; ++i)
+		{
+			values.push_back(std::ldexp(static_cast<double>(generator() >> 11), -static_cast<int>(generator() % 60)));
+
+			const double power = std::ldexp(1.0, static_cast<int>(generator() % 2000) - 1000);
+			values.push_back(std::nextafter(power, 0.0));
+			values.push_back(std::nextafter(power, std::numeric_limits<double>::infinity()));
+
+			const double root = std::ldexp(static_cast<double>(generator() >> 11), static_cast<int>(generator() % 100) - 50 - 53);
+			values.push_back(root * root);
+			values.push_back(std::nextafter(root * root, 0.0));
+		}
+
+		auto mismatches = [&](auto reproducible, auto batch_reproducible, auto algorithm)
+		{
+			std::vector<double> results(values.size());
+			batch_reproducible(values, results);
+
+			int count = 0;
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				const auto bits = std::bit_cast<unsigned long long>(algorithm(values[i]));
+				if ((bits != std::bit_cast<unsigned long long>(reproducible(values[i]))) || (bits != std::bit_cast<unsigned long long>(results[i])))
+					++count;
+			}
+
+			return count;
+		};
+
+		using cxcm::reproducible_policy;
+		CHECK(mismatches([](double x) { return cxcm::trunc<reproducible_policy>(x); }, cxcm::batch::trunc<reproducible_policy, double>, [](double x) { return cxcm::detail::constexpr_trunc(x); }) == 0);
+		CHECK(mismatches([](double x) { return cxcm::floor<reproducible_policy>(x); }, cxcm::batch::floor<reproducible_policy, double>, [](double x) { return cxcm::detail::constexpr_floor(x); }) == 0);
+		CHECK(mismatches([](double x) { return cxcm::ceil<reproducible_policy>(x); }, cxcm::batch::ceil<reproducible_policy, double>, [](double x) { return cxcm::detail::constexpr_ceil(x); }) == 0);
+		CHECK(mismatches([](double x) { return cxcm::round<reproducible_policy>(x); }, cxcm::batch::round<reproducible_policy, double>, [](double x) { return cxcm::detail::constexpr_round(x); }) == 0);
+		CHECK(mismatches([](double x) { return cxcm::round_even<reproducible_policy>(x); }, cxcm::batch::round_even<reproducible_policy, double>, [](double x) { return cxcm::detail::constexpr_round_even(x); }) == 0);
+		CHECK(mismatches([](double x) { return cxcm::fract<reproducible_policy>(x); }, cxcm::batch::fract<reproducible_policy, double>, [](double x) { return cxcm::detail::constexpr_fract(x); }) == 0);
+		CHECK(mismatches([](double x) { return cxcm::sqrt<reproducible_policy>(x); }, cxcm::batch::sqrt<reproducible_policy, double>, [](double x) { return cxcm::detail::constexpr_sqrt(x); }) == 0);
+		CHECK(mismatches([](double x) { return cxcm::rsqrt<reproducible_policy>(x); }, cxcm::batch::rsqrt<reproducible_policy, double>, [](double x) { return cxcm::detail::constexpr_rsqrt(x); }) == 0);
+
+		// fmod() is exact, so the standard library has the same bits
+		int fmod_mismatches = 0;
+		for (std::size_t i = 0; i + 1 < values.size(); i += 2)
+		{
+			for (auto [x, y] : {std::pair(values[i], values[i + 1]), std::pair(values[i + 1], values[i])})
+			{
+				if (std::bit_cast<unsigned long long>(cxcm::fmod<reproducible_policy>(x, y)) != std::bit_cast<unsigned long long>(cxcm::detail::constexpr_fmod(x, y)))
+					++fmod_mismatches;
+			}
+		}
+
+		CHECK(fmod_mismatches == 0);
+	}
 }
 
 TEST_SUITE("constexpr_math for float")
@@ -1137,8 +1863,703 @@ TEST_SUITE("constexpr_math for float")
 		// off by 1 ulp
 //		CHECK_EQ(std::numbers::inv_sqrtpi_v<float>, cxcm::rsqrt(std::numbers::pi_v<float>));
 	}
+
+#if defined(CXCM_ENABLE_STATS)
+	TEST_CASE("testing cxcm::stats float values")
+	{
+		// constant evaluation isn't counted
+		static_assert(cxcm::detail::constexpr_sqrt(2.0f) == std::numbers::sqrt2_v<float>);
+
+		cxcm::stats::reset();
+
+		std::vector<float> values = {2.0f, 3.0f, 0.37f, 1.0e30f, 0.0f, -1.0f,
+			std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()};
+		for (float value : values)
+			CHECK(std::bit_cast<unsigned int>(cxcm::detail::constexpr_sqrt(value)) == std::bit_cast<unsigned int>(cxcm::sqrt(value)));
+
+		// another thread's counts are kept after it is done
+		std::thread([]() { CHECK(cxcm::detail::constexpr_floor(0x1.0p30f) == 0x1.0p30f); }).join();
+
+		const auto counts = cxcm::stats::snapshot();
+		CHECK(counts.nan == 1);
+		CHECK(counts.infinity == 1);
+		CHECK(counts.zero == 1);
+		CHECK(counts.out_of_range == 2);
+		CHECK(std::accumulate(counts.float_sqrt_steps.begin(), counts.float_sqrt_steps.end(), std::uint64_t{}) == 4);
+		CHECK(std::accumulate(counts.double_sqrt_steps.begin(), counts.double_sqrt_steps.end(), std::uint64_t{}) == 0);
+
+		cxcm::stats::reset();
+		CHECK(cxcm::stats::snapshot().out_of_range == 0);
+	}
+#endif
+
+#if defined(CXCM_ENABLE_PATH_STATS)
+	TEST_CASE("testing cxcm::stats::path_counts() float values")
+	{
+		cxcm::stats::reset();
+
+		std::vector<float> values;
+		for (int i = -50; i < 50; ++i)
+			values.push_back(static_cast<float>(i) * 0.37f);
+
+		std::vector<float> results(values.size());
+		for (std::size_t i = 0; i < values.size(); ++i)
+			results[i] = cxcm::floor(values[i]) + cxcm::fract(values[i]);
+
+		// the scalar tails of the batch function aren't counted as std:: calls
+		cxcm::batch::floor<float>(values, results);
+
+		const auto counts = cxcm::stats::path_counts();
+		auto values_for = [&](std::string_view function, std::string_view path)
+		{
+			std::uint64_t total = 0;
+			for (const auto &count : counts)
+			{
+				if ((count.function == function) && count.path.starts_with(path))
+					total += count.values;
+			}
+			return total;
+		};
+
+		CHECK(values_for("floor<float>", "std") == 100);
+		CHECK(values_for("fract<float>", "cxcm") == 100);
+		CHECK(values_for("floor<float>", "batch") == 100);
+
+		const std::string report = cxcm::stats::path_report();
+		CHECK(report.find("try batch::fract") != std::string::npos);
+
+		cxcm::stats::reset();
+		CHECK(cxcm::stats::path_counts().empty());
+	}
+#endif
+
+	TEST_CASE("testing cxcm::make_table() float values")
+	{
+		constexpr auto table = cxcm::make_table<64>([](float x) { return x * x; }, -1.0f, 1.0f);
+
+		static_assert(table.linear(-1.0f) == 1.0f);
+		CHECK(table.max_error([](float x) { return x * x; }, cxcm::interpolation::cubic) < 1.0e-6f);
+
+		std::vector<float> values;
+		for (int i = 0; i < 100; ++i)
+			values.push_back(-1.25f + i * 0.025f);
+
+		std::vector<float> results(values.size());
+		cxcm::batch::lookup(table, cxcm::interpolation::linear, values, results);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			CHECK(results[i] == doctest::Approx(table.linear(values[i])).epsilon(1.0e-6));
+	}
+
+	TEST_CASE("testing cxcm::make_half_table() float16 and bfloat16 values")
+	{
+		// conversions to float
+		static_assert(static_cast<float>(cxcm::float16::from_bits(0x3C00)) == 1.0f);
+		static_assert(static_cast<float>(cxcm::float16::from_bits(0xC000)) == -2.0f);
+		static_assert(static_cast<float>(cxcm::float16::from_bits(0x7BFF)) == 65504.0f);
+		static_assert(static_cast<float>(cxcm::float16::from_bits(0x0001)) == 0x1.0p-24f);
+		static_assert(static_cast<float>(cxcm::float16::from_bits(0x8000)) == 0.0f);
+		static_assert(cxcm::signbit(static_cast<float>(cxcm::float16::from_bits(0x8000))));
+		static_assert(static_cast<float>(cxcm::float16::from_bits(0xFC00)) == -std::numeric_limits<float>::infinity());
+		static_assert(cxcm::isnan(static_cast<float>(cxcm::float16::from_bits(0x7E00))));
+		static_assert(static_cast<float>(cxcm::bfloat16::from_bits(0x3F80)) == 1.0f);
+		static_assert(static_cast<float>(cxcm::bfloat16::from_bits(0xC040)) == -3.0f);
+
+		static constexpr auto floor_table = cxcm::make_half_table<cxcm::float16>([](float x) { return cxcm::floor(x); });
+		static constexpr auto square_table = cxcm::make_half_table<cxcm::bfloat16>([](float x) { return static_cast<double>(x) * x; });
+
+		std::vector<cxcm::float16> halves;
+		std::vector<cxcm::bfloat16> brains;
+		for (unsigned int i = 0; i < 65536; ++i)
+		{
+			halves.push_back(cxcm::float16::from_bits(static_cast<std::uint16_t>(i)));
+			brains.push_back(cxcm::bfloat16::from_bits(static_cast<std::uint16_t>(i)));
+		}
+
+		std::vector<float> floors(halves.size());
+		cxcm::batch::lookup(floor_table, halves, floors);
+
+		std::vector<double> squares(brains.size());
+		cxcm::batch::lookup(square_table, brains, squares);
+
+		int floor_mismatches = 0;
+		int square_mismatches = 0;
+		for (std::size_t i = 0; i < halves.size(); ++i)
+		{
+			const float half = static_cast<float>(halves[i]);
+			const float brain = static_cast<float>(brains[i]);
+
+			if (std::bit_cast<unsigned int>(floors[i]) != std::bit_cast<unsigned int>(std::floor(half)) && !cxcm::isnan(half))
+				++floor_mismatches;
+
+			if ((squares[i] != static_cast<double>(brain) * brain) && !cxcm::isnan(brain))
+				++square_mismatches;
+		}
+
+		CHECK(floor_mismatches == 0);
+		CHECK(square_mismatches == 0);
+		CHECK(floor_table(cxcm::float16::from_bits(0x3E00)) == 1.0f);
+	}
+
+	TEST_CASE("testing cxcm::float16 and cxcm::bfloat16 rounding and classification")
+	{
+		// round to nearest, ties to even
+		static_assert(cxcm::float16(1.0f).bits == 0x3C00);
+		static_assert(cxcm::float16(1.0f + 0x1.0p-11f).bits == 0x3C00);
+		static_assert(cxcm::float16(1.0f + 0x3.0p-11f).bits == 0x3C02);
+		static_assert(cxcm::float16(65504.0f).bits == 0x7BFF);
+		static_assert(cxcm::float16(65519.0f).bits == 0x7BFF);
+		static_assert(cxcm::float16(65520.0f).bits == 0x7C00);
+		static_assert(cxcm::float16(-0x1.0p-24f).bits == 0x8001);
+		static_assert(cxcm::float16(0x1.0p-25f).bits == 0x0000);
+		static_assert(cxcm::float16(0x1.000002p-25f).bits == 0x0001);
+		static_assert(cxcm::float16(0x1.FFAp-15f).bits == 0x03FF);
+		static_assert(cxcm::float16(0x1.FFCp-15f).bits == 0x0400);
+		static_assert(cxcm::float16(std::numeric_limits<float>::quiet_NaN()).bits == 0x7E00);
+		static_assert(cxcm::bfloat16(1.0f + 0x1.0p-8f).bits == 0x3F80);
+		static_assert(cxcm::bfloat16(1.0f + 0x3.0p-8f).bits == 0x3F82);
+		static_assert(cxcm::bfloat16(std::numeric_limits<float>::max()).bits == 0x7F80);
+		static_assert(cxcm::bfloat16(-std::numeric_limits<float>::quiet_NaN()).bits == 0xFFC0);
+
+		// just above a tie, which rounding through float would lose
+		static_assert(cxcm::float16(1.0 + 0x1.0p-11 + 0x1.0p-40).bits == 0x3C01);
+		static_assert(cxcm::bfloat16(1.0 + 0x1.0p-8 + 0x1.0p-40).bits == 0x3F81);
+
+		// classification
+		static_assert(cxcm::fpclassify(cxcm::float16::from_bits(0x0001)) == FP_SUBNORMAL);
+		static_assert(cxcm::fpclassify(cxcm::float16::from_bits(0x8000)) == FP_ZERO);
+		static_assert(cxcm::fpclassify(cxcm::float16::from_bits(0x0400)) == FP_NORMAL);
+		static_assert(cxcm::fpclassify(cxcm::bfloat16::from_bits(0x0001)) == FP_SUBNORMAL);
+		static_assert(cxcm::isinf(cxcm::float16::from_bits(0xFC00)));
+		static_assert(cxcm::isnan(cxcm::bfloat16::from_bits(0x7F81)));
+		static_assert(!cxcm::isfinite(cxcm::float16::from_bits(0x7E00)));
+		static_assert(cxcm::isnormal(cxcm::bfloat16(-3.0f)));
+		static_assert(cxcm::signbit(cxcm::float16(-0.0f)));
+		static_assert(cxcm::copysign(cxcm::float16(2.0f), cxcm::float16(-1.0f)).bits == 0xC000);
+		static_assert(cxcm::abs(cxcm::bfloat16(-3.0f)).bits == 0x4040);
+
+		// rounding functions
+		static_assert(cxcm::floor(cxcm::float16(-2.5f)).bits == cxcm::float16(-3.0f).bits);
+		static_assert(cxcm::ceil(cxcm::float16(-2.5f)).bits == cxcm::float16(-2.0f).bits);
+		static_assert(cxcm::round(cxcm::bfloat16(2.5f)).bits == cxcm::bfloat16(3.0f).bits);
+		static_assert(cxcm::round_even(cxcm::bfloat16(2.5f)).bits == cxcm::bfloat16(2.0f).bits);
+		static_assert(cxcm::trunc(cxcm::float16(-1.5f)).bits == cxcm::float16(-1.0f).bits);
+		static_assert(cxcm::fract(cxcm::float16(2.25f)).bits == cxcm::float16(0.25f).bits);
+		static_assert(cxcm::sqrt(cxcm::float16(2.0f)).bits == cxcm::float16(1.41421356237309505).bits);
+
+		// every finite value survives the round trip through float, and sqrt is correctly rounded
+		int round_trip_mismatches = 0;
+		int sqrt_mismatches = 0;
+		for (unsigned int i = 0; i < 65536; ++i)
+		{
+			const auto half = cxcm::float16::from_bits(static_cast<std::uint16_t>(i));
+			const auto brain = cxcm::bfloat16::from_bits(static_cast<std::uint16_t>(i));
+
+			if (!cxcm::isnan(half) && (cxcm::float16(static_cast<float>(half)).bits != half.bits))
+				++round_trip_mismatches;
+
+			if (!cxcm::isnan(brain) && (cxcm::bfloat16(static_cast<float>(brain)).bits != brain.bits))
+				++round_trip_mismatches;
+
+			if (!cxcm::isnan(half) && (cxcm::sqrt(half).bits != cxcm::float16(std::sqrt(static_cast<double>(static_cast<float>(half)))).bits))
+				++sqrt_mismatches;
+		}
+
+		CHECK(round_trip_mismatches == 0);
+		CHECK(sqrt_mismatches == 0);
+	}
+
+	TEST_CASE("testing cxcm::batch::convert() float16 and bfloat16 values")
+	{
+		// a spread of float bit patterns, plus the edges
+		std::vector<float> values;
+		for (unsigned long long i = 0; i < 0x100000000ULL; i += 65521)
+			values.push_back(std::bit_cast<float>(static_cast<unsigned int>(i)));
+
+		for (float edge : {0.0f, -0.0f, 65504.0f, 65519.0f, 65520.0f, 0x1.0p-25f, 0x1.0p-24f, 0x1.8p-24f, 0x1.FFCp-15f,
+						   std::numeric_limits<float>::infinity(), std::numeric_limits<float>::max(), std::numeric_limits<float>::denorm_min()})
+			values.push_back(edge);
+
+		std::vector<cxcm::float16> halves(values.size());
+		std::vector<cxcm::bfloat16> brains(values.size());
+		cxcm::batch::convert(values, halves);
+		cxcm::batch::convert(values, brains);
+
+		std::vector<float> half_floats(values.size());
+		std::vector<float> brain_floats(values.size());
+		cxcm::batch::convert(halves, half_floats);
+		cxcm::batch::convert(brains, brain_floats);
+
+		int mismatches = 0;
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if (halves[i].bits != cxcm::float16(values[i]).bits)
+				++mismatches;
+
+			if (brains[i].bits != cxcm::bfloat16(values[i]).bits)
+				++mismatches;
+
+			if (std::bit_cast<unsigned int>(half_floats[i]) != std::bit_cast<unsigned int>(static_cast<float>(halves[i])))
+				++mismatches;
+
+			if (std::bit_cast<unsigned int>(brain_floats[i]) != std::bit_cast<unsigned int>(static_cast<float>(brains[i])))
+				++mismatches;
+		}
+
+		CHECK(mismatches == 0);
+		std::vector<cxcm::float16> too_few(1);
+		CHECK_THROWS_AS(cxcm::batch::convert(values, too_few), std::length_error);
+	}
+
+	TEST_CASE("testing cxcm::reproducible_sum() float values")
+	{
+		constexpr std::array<float, 10> tenths = {0.1f, 0.1f, 0.1f, 0.1f, 0.1f, 0.1f, 0.1f, 0.1f, 0.1f, 0.1f};
+		static_assert(cxcm::reproducible_sum(tenths) == 1.0f);
+
+		std::vector<float> values(50000, 0.1f);
+		values.push_back(1.0e8f);
+		values.push_back(-1.0e8f);
+
+		const float serial_sum = cxcm::reproducible_sum(values);
+		CHECK(serial_sum == cxcm::reproducible_sum(values, 3));
+
+		std::reverse(values.begin(), values.end());
+		CHECK(serial_sum == cxcm::reproducible_sum(values));
+		CHECK(serial_sum == cxcm::reproducible_sum(values, 2));
+	}
+
+	TEST_CASE("testing cxcm::approx float values")
+	{
+		static_assert(cxcm::approx<4>::recip_steps<float> == 0);
+		static_assert(cxcm::approx<12>::rsqrt_steps<float> == 2);
+		static_assert(cxcm::approx<20>::rsqrt_steps<float> == 3);
+		static_assert(cxcm::approx<12>::exp2(3.0f) == 8.0f);
+		static_assert(cxcm::approx<12>::log2(0.125f) == -3.0f);
+		static_assert(cxcm::abs(cxcm::approx<12>::rsqrt(2.0f) - 0.70710678f) < 0.70710678f / 4096);
+
+		// a spread of the positive normal floats, which main.cxx checks exhaustively
+		std::vector<float> values;
+		for (unsigned int i = 0x00800000; i < 0x7F800000; i += 65521)
+			values.push_back(std::bit_cast<float>(i));
+
+		auto worst_error = [&](auto approximation, auto exact, bool relative_to_one)
+		{
+			double worst = 0.0;
+			for (float value : values)
+			{
+				const double expected = exact(static_cast<double>(value));
+				const double scale = relative_to_one ? std::max(1.0, std::abs(expected)) : std::abs(expected);
+				worst = std::max(worst, std::abs(static_cast<double>(approximation(value)) - expected) / scale);
+			}
+
+			return worst;
+		};
+
+		CHECK(worst_error([](float x) { return cxcm::approx<12>::sqrt(x); }, [](double x) { return std::sqrt(x); }, false) <= 0x1.0p-12);
+		CHECK(worst_error([](float x) { return cxcm::approx<12>::rsqrt(x); }, [](double x) { return 1.0 / std::sqrt(x); }, false) <= 0x1.0p-12);
+		CHECK(worst_error([](float x) { return cxcm::approx<20>::rsqrt(x); }, [](double x) { return 1.0 / std::sqrt(x); }, false) <= 0x1.0p-20);
+		CHECK(worst_error([](float x) { return cxcm::approx<20>::log2(x); }, [](double x) { return std::log2(x); }, true) <= 0x1.0p-20);
+		CHECK(worst_error([](float x) { return cxcm::approx<23>::log2(x); }, [](double x) { return std::log2(x); }, true) <= 0x1.0p-23);
+
+		// recip() only takes values under 2^125
+		std::erase_if(values, [](float value) { return value >= 0x1.0p125f; });
+		CHECK(worst_error([](float x) { return cxcm::approx<16>::recip(-x); }, [](double x) { return -1.0 / x; }, false) <= 0x1.0p-16);
+
+		for (float &value : values)
+			value = std::fmod(value, 253.0f) - 126.0f;
+
+		CHECK(worst_error([](float x) { return cxcm::approx<12>::exp2(x); }, [](double x) { return std::exp2(x); }, false) <= 0x1.0p-12);
+		CHECK(worst_error([](float x) { return cxcm::approx<22>::exp2(x); }, [](double x) { return std::exp2(x); }, false) <= 0x1.0p-22);
+
+		// the batch versions give the same bits
+		std::vector<float> results(values.size());
+		cxcm::batch::approx<12>::exp2<float>(values, results);
+
+		int mismatches = 0;
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if (std::bit_cast<unsigned int>(results[i]) != std::bit_cast<unsigned int>(cxcm::approx<12>::exp2(values[i])))
+				++mismatches;
+		}
+
+		for (float &value : values)
+			value = std::exp2(value);
+
+		cxcm::batch::approx<20>::rsqrt<float>(values, results);
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if (std::bit_cast<unsigned int>(results[i]) != std::bit_cast<unsigned int>(cxcm::approx<20>::rsqrt(values[i])))
+				++mismatches;
+		}
+
+		CHECK(mismatches == 0);
+
+		// the same bits at compile time as at runtime, fma or not
+		CHECK(approx_runtime_mismatches<float, [](float x) { return cxcm::approx<12>::sqrt(x); }>() == 0);
+		CHECK(approx_runtime_mismatches<float, [](float x) { return cxcm::approx<20>::rsqrt(x); }>() == 0);
+		CHECK(approx_runtime_mismatches<float, [](float x) { return cxcm::approx<23>::rsqrt(x); }>() == 0);
+		CHECK(approx_runtime_mismatches<float, [](float x) { return cxcm::approx<20>::recip(-x); }>() == 0);
+		CHECK(approx_runtime_mismatches<float, [](float x) { return cxcm::approx<20>::exp2(x); }>() == 0);
+		CHECK(approx_runtime_mismatches<float, [](float x) { return cxcm::approx<22>::exp2(-x); }>() == 0);
+		CHECK(approx_runtime_mismatches<float, [](float x) { return cxcm::approx<20>::log2(x); }>() == 0);
+		CHECK(approx_runtime_mismatches<float, [](float x) { return cxcm::approx<23>::log2(x); }>() == 0);
+	}
+
+	TEST_CASE("testing cxcm::batch tiers float values")
+	{
+		static_assert(cxcm::batch::tier_name(cxcm::batch::tier::scalar) == "scalar");
+		static_assert(cxcm::batch::tier_name(cxcm::batch::tier::sse4_2) == "sse4.2");
+		static_assert(cxcm::batch::tier_name(cxcm::batch::tier::avx512) == "avx512");
+		static_assert(cxcm::batch::tier::scalar < cxcm::batch::tier::avx2);
+
+		CHECK(cxcm::batch::active_tier() <= cxcm::batch::detected_tier());
+		CHECK(cxcm::batch::active_tier() == cxcm::batch::active_tier());
+
+		// whichever kernels run (CXCM_FORCE_TIER picks them), the results are the scalar ones
+		std::vector<float> values;
+		for (int i = -1000; i <= 1000; ++i)
+			values.push_back(static_cast<float>(i) * 0.37f);
+
+		for (float edge : {-0.0f, 0.5f, -0.5f, 2147483520.0f, 2147483648.0f, -2147483648.0f, -2147483904.0f,
+						   std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()})
+			values.push_back(edge);
+
+		std::vector<int> floors(values.size());
+		std::vector<int> ceils(values.size());
+		cxcm::batch::ifloor<int, float>(values, floors);
+		cxcm::batch::iceil<int, float>(values, ceils);
+
+		int mismatches = 0;
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if (floors[i] != cxcm::ifloor<int>(values[i]))
+				++mismatches;
+
+			if (ceils[i] != cxcm::iceil<int>(values[i]))
+				++mismatches;
+		}
+
+		CHECK(mismatches == 0);
+	}
+
+	TEST_CASE("testing cxcm::batch::subnormals::flush and cxcm::flush_denormals_scope float values")
+	{
+		constexpr float smallest = std::numeric_limits<float>::min();
+		constexpr float tiniest = std::numeric_limits<float>::denorm_min();
+
+		std::vector<float> values;
+		for (int i = -500; i <= 500; ++i)
+			values.push_back(static_cast<float>(i) * 0x1.0p-135f);
+
+		for (float edge : {smallest, -smallest, smallest - tiniest, -(smallest - tiniest), 0.37f, -2.5f, 1.0e30f,
+						   std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()})
+			values.push_back(edge);
+
+		std::vector<float> flushed(values.size());
+		std::transform(values.begin(), values.end(), flushed.begin(), [](float x) { return (cxcm::abs(x) < smallest) ? cxcm::copysign(0.0f, x) : x; });
+
+		// the results for the values with their subnormals made zeros, the same with FTZ and DAZ set as without
+		std::vector<float> results(values.size());
+		std::vector<float> expected(values.size());
+		auto mismatches = [&](auto batch_function, auto flushing_function)
+		{
+			batch_function(flushed, expected);
+
+			int count = 0;
+			for (int scope = 0; scope < 2; ++scope)
+			{
+				if (scope == 0)
+				{
+					flushing_function(values, results);
+				}
+				else
+				{
+					const cxcm::flush_denormals_scope scope;
+					flushing_function(values, results);
+				}
+
+				for (std::size_t i = 0; i < values.size(); ++i)
+				{
+					if (std::bit_cast<std::uint32_t>(results[i]) != std::bit_cast<std::uint32_t>(expected[i]))
+						++count;
+				}
+			}
+
+			return count;
+		};
+
+		constexpr auto flush = cxcm::batch::subnormals::flush;
+		CHECK(mismatches(cxcm::batch::floor<float>, cxcm::batch::floor<float, flush>) == 0);
+		CHECK(mismatches(cxcm::batch::ceil<float>, cxcm::batch::ceil<float, flush>) == 0);
+		CHECK(mismatches(cxcm::batch::trunc<float>, cxcm::batch::trunc<float, flush>) == 0);
+		CHECK(mismatches(cxcm::batch::round<float>, cxcm::batch::round<float, flush>) == 0);
+		CHECK(mismatches(cxcm::batch::round_even<cxcm::reproducible_policy, float>, cxcm::batch::round_even<cxcm::reproducible_policy, float, flush>) == 0);
+		CHECK(mismatches(cxcm::batch::fract<float>, cxcm::batch::fract<float, flush>) == 0);
+		CHECK(mismatches(cxcm::batch::sqrt<float>, cxcm::batch::sqrt<float, flush>) == 0);
+		CHECK(mismatches(cxcm::batch::rsqrt<cxcm::fast_policy, float>, cxcm::batch::rsqrt<cxcm::fast_policy, float, flush>) == 0);
+
+		cxcm::batch::ceil<float, flush>(std::span<const float>(values).first(1), results);
+		CHECK(results[0] == 0.0f);
+		CHECK(cxcm::signbit(results[0]));
+
+		// the bits go back at the end of the scope
+		if (cxcm::flush_denormals_scope::supported())
+		{
+			volatile float tiny = tiniest;
+			{
+				const cxcm::flush_denormals_scope flush;
+				CHECK(tiny * 1.0f == 0.0f);
+			}
+			CHECK(tiny * 1.0f == tiniest);
+		}
+	}
+
+#if defined(CXCM_AUTOTUNE)
+	TEST_CASE("testing cxcm::batch autotuning float values")
+	{
+		std::vector<float> values;
+		for (int i = -1000; i <= 1000; ++i)
+			values.push_back(static_cast<float>(i) * 0.37f);
+
+		// tuning happens the first time, and changes nothing but the speed
+		std::vector<float> results(values.size());
+		cxcm::batch::trunc<float>(values, results);
+
+		int mismatches = 0;
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			if (results[i] != cxcm::trunc(values[i]))
+				++mismatches;
+		}
+
+		CHECK(mismatches == 0);
+
+		const auto decisions = cxcm::batch::tuning_decisions();
+		const auto decision = std::find_if(decisions.begin(), decisions.end(), [](const auto &d) { return d.function == "trunc<float>"; });
+		REQUIRE(decision != decisions.end());
+		CHECK(decision->choice <= cxcm::batch::active_tier());
+		CHECK(cxcm::batch::tuned_tier("trunc<float>") == decision->choice);
+		CHECK(cxcm::batch::tuned_tier("not a function") == cxcm::batch::active_tier());
+		CHECK(!cxcm::batch::tuning_cache_path().empty());
+	}
+#endif
 }
 
+TEST_SUITE("constexpr_math for long double")
+{
+	TEST_CASE("testing fidelity of cxcm::signbit() and cxcm::copysign() with std:: for long double values")
+	{
+		auto pos_nan = std::numeric_limits<long double>::quiet_NaN();
+		auto neg_nan = -std::numeric_limits<long double>::quiet_NaN();
+		auto pos_inf = std::numeric_limits<long double>::infinity();
+		auto neg_inf = -std::numeric_limits<long double>::infinity();
+		long double pos_zero = 0;
+		long double neg_zero = std::copysign(0.0L, -1.0L);
+		long double pos_four = 4;
+		long double neg_four = -4;
+
+		for (long double value : {pos_nan, neg_nan, pos_inf, neg_inf, pos_zero, neg_zero, pos_four, neg_four})
+		{
+			CHECK(cxcm::signbit(value) == std::signbit(value));
+
+			for (long double sgn : {pos_nan, neg_nan, pos_inf, neg_inf, pos_zero, neg_zero, pos_four, neg_four})
+			{
+				if (!cxcm::isnan(value))
+					CHECK(cxcm::copysign(value, sgn) == std::copysign(value, sgn));
+
+				CHECK(cxcm::signbit(cxcm::copysign(value, sgn)) == std::signbit(std::copysign(value, sgn)));
+			}
+		}
+
+		static_assert(cxcm::signbit(-0.0L));
+		static_assert(cxcm::copysign(3.0L, -1.0L) == -3.0L);
+		static_assert(cxcm::fabs(-3.0L) == 3.0L);
+		static_assert(cxcm::is_negative_zero(cxcm::negative_zero<long double>));
+		static_assert(!cxcm::is_negative_zero(0.0L));
+	}
+
+	TEST_CASE("testing cxcm classification for long double values")
+	{
+		static_assert(cxcm::isnan(std::numeric_limits<long double>::quiet_NaN()));
+		static_assert(cxcm::isinf(-std::numeric_limits<long double>::infinity()));
+		static_assert(cxcm::fpclassify(std::numeric_limits<long double>::denorm_min()) == FP_SUBNORMAL);
+		static_assert(cxcm::fpclassify(std::numeric_limits<long double>::min()) == FP_NORMAL);
+		static_assert(cxcm::fpclassify(-0.0L) == FP_ZERO);
+		static_assert(cxcm::isnormal(std::numeric_limits<long double>::max()));
+		static_assert(!cxcm::isfinite(std::numeric_limits<long double>::infinity()));
+
+		// signaling NaN becomes quiet
+		constexpr long double quieted = cxcm::detail::convert_to_quiet_nan(std::numeric_limits<long double>::signaling_NaN());
+		CHECK(cxcm::isnan(quieted));
+		CHECK(std::isnan(quieted));
+	}
+
+	TEST_CASE("testing fidelity of cxcm rounding with std:: for long double values")
+	{
+		constexpr long double largest_fractional = cxcm::limits::largest_fractional_value<long double>;
+
+		const long double values[] = {0.0L, -0.0L, 0.25L, -0.25L, 0.5L, -0.5L, 0.75L, -0.75L, 1.5L, -1.5L, 2.5L, -2.5L, 13.75L, -1.825L,
+									  std::numeric_limits<long double>::denorm_min(), -std::numeric_limits<long double>::denorm_min(),
+									  std::numeric_limits<long double>::epsilon(), -std::numeric_limits<long double>::epsilon(),
+									  std::numeric_limits<long double>::min(), -std::numeric_limits<long double>::min(),
+									  std::numeric_limits<long double>::max(), std::numeric_limits<long double>::lowest(),
+									  std::numeric_limits<long double>::infinity(), -std::numeric_limits<long double>::infinity(),
+									  largest_fractional, -largest_fractional, largest_fractional - 0.5L, 0x1.0p+63L, 0x1.0p+64L, 0x1.0p+62L + 0.5L};
+
+		for (long double value : values)
+		{
+			CHECK(cxcm::detail::constexpr_trunc(value) == std::trunc(value));
+			CHECK(cxcm::detail::constexpr_floor(value) == std::floor(value));
+			CHECK(cxcm::detail::constexpr_ceil(value) == std::ceil(value));
+			CHECK(cxcm::detail::constexpr_round(value) == std::round(value));
+			CHECK(cxcm::round_even(value) == std::nearbyint(value));
+			CHECK(cxcm::signbit(cxcm::detail::constexpr_floor(value)) == std::signbit(std::floor(value)));
+		}
+
+		CHECK(cxcm::isnan(cxcm::detail::constexpr_floor(std::numeric_limits<long double>::quiet_NaN())));
+
+		static_assert(cxcm::floor(-1.5L) == -2.0L);
+		static_assert(cxcm::ceil(0x1.fffffffffffffffep+61L) == 0x1.0p+62L);
+		static_assert(cxcm::round(largest_fractional) == 0x1.0p+63L);
+		static_assert(cxcm::trunc(-largest_fractional) == -0x1.fffffffffffffffcp+62L);
+		static_assert(cxcm::fract(-0.25L) == 0.75L);
+	}
+
+	TEST_CASE("constexpr sqrt() and rsqrt() for long double")
+	{
+		static_assert(cxcm::sqrt(4.0L) == 2.0L);
+		static_assert(cxcm::sqrt(0x1.0p-16444L) == 0x1.0p-8222L);
+		static_assert(cxcm::is_negative_zero(cxcm::sqrt(-0.0L)));
+		static_assert(cxcm::sqrt(std::numeric_limits<long double>::infinity()) == std::numeric_limits<long double>::infinity());
+		static_assert(cxcm::rsqrt(0.25L) == 2.0L);
+
+		CHECK(cxcm::detail::constexpr_sqrt(2.0L) == std::sqrt(2.0L));
+		CHECK(cxcm::detail::constexpr_sqrt(std::numeric_limits<long double>::max()) == std::sqrt(std::numeric_limits<long double>::max()));
+		CHECK(cxcm::detail::constexpr_sqrt(std::numeric_limits<long double>::denorm_min()) == std::sqrt(std::numeric_limits<long double>::denorm_min()));
+		CHECK(cxcm::isnan(cxcm::detail::constexpr_sqrt(-1.0L)));
+
+		// correctly rounded, so it agrees with the hardware
+		int mismatches = 0;
+		unsigned long long state = 0x9E3779B97F4A7C15ULL;
+		for (int i = 0; i < 100000; ++i)
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			const long double value = std::ldexp(static_cast<long double>(state | 1), static_cast<int>(state % 32000) - 16000 - 64);
+
+			if (cxcm::relaxed::detail::extended_sqrt(value) != std::sqrt(value))
+				++mismatches;
+		}
+
+		CHECK(mismatches == 0);
+
+		CHECK(cxcm::rsqrt(3.0L) == doctest::Approx(1.0L / std::sqrt(3.0L)).epsilon(1.0e-18));
+	}
+}
+
+#if defined(CXCM_HAS_FLOAT128)
+
+TEST_SUITE("constexpr_math for __float128")
+{
+	constexpr __float128 quad(double value) noexcept
+	{
+		return static_cast<__float128>(value);
+	}
+
+	constexpr bool same_bits(__float128 a, std::uint64_t high, std::uint64_t low) noexcept
+	{
+		const auto bits = cxcm::bitwise::to_quad_bits(a);
+		return (bits.high == high) && (bits.low == low);
+	}
+
+	TEST_CASE("testing cxcm rounding and classification for __float128 values")
+	{
+		static_assert(cxcm::trunc(quad(-2.75)) == quad(-2.0));
+		static_assert(cxcm::floor(quad(-2.25)) == quad(-3.0));
+		static_assert(cxcm::ceil(quad(2.25)) == quad(3.0));
+		static_assert(cxcm::round(quad(2.5)) == quad(3.0));
+		static_assert(cxcm::round(quad(-0.5)) == quad(-1.0));
+		static_assert(cxcm::signbit(cxcm::ceil(quad(-0.25))));
+		static_assert(cxcm::floor(quad(0x1.0p+60) + quad(0.75)) == quad(0x1.0p+60));
+		static_assert(cxcm::floor(cxcm::limits::largest_fractional_value<__float128>) == quad(0x1.0p+112) - quad(1.0));
+		static_assert(cxcm::round(cxcm::limits::largest_fractional_value<__float128>) == quad(0x1.0p+112));
+		static_assert(same_bits(cxcm::floor(cxcm::bitwise::from_quad_bits<__float128>({0xBFFF000000000000, 1})), 0xC000000000000000, 0));
+
+		static_assert(cxcm::fpclassify(cxcm::bitwise::from_quad_bits<__float128>({0, 1})) == FP_SUBNORMAL);
+		static_assert(cxcm::fpclassify(quad(-0.0)) == FP_ZERO);
+		static_assert(cxcm::isnormal(quad(1.0e-300) * quad(1.0e-300)));
+		static_assert(cxcm::isinf(quad(std::numeric_limits<double>::infinity())));
+		static_assert(cxcm::isnan(quad(std::numeric_limits<double>::quiet_NaN())));
+		static_assert(!cxcm::isfinite(quad(-std::numeric_limits<double>::infinity())));
+		static_assert(cxcm::signbit(cxcm::copysign(quad(2.0), quad(-0.0))));
+		static_assert(cxcm::abs(quad(-3.0)) == quad(3.0));
+
+		// correctly rounded, where libquadmath's sqrtq() rounds up
+		static_assert(same_bits(cxcm::sqrt(quad(2.0)), 0x3FFF6A09E667F3BC, 0xC908B2FB1366EA95));
+		static_assert(same_bits(cxcm::sqrt(cxcm::bitwise::from_quad_bits<__float128>({0, 1})), 0x1FC8000000000000, 0));
+		static_assert(cxcm::isnan(cxcm::sqrt(quad(-1.0))));
+		static_assert(cxcm::signbit(cxcm::sqrt(quad(-1.0))));
+		static_assert(same_bits(cxcm::sqrt(quad(-std::numeric_limits<double>::infinity())), 0xFFFF800000000000, 0));
+		static_assert(cxcm::signbit(cxcm::sqrt(quad(-0.0))));
+		CHECK(cxcm::signbit(cxcm::sqrt(quad(-1.0))) == cxcm::signbit(cxcm::sqrt(-1.0)));
+
+		// the fix up applied to libquadmath's sqrtq() with CXCM_USE_QUADMATH
+		constexpr cxcm::bitwise::uint128 two_significand{0x0002000000000000, 0};
+		constexpr cxcm::bitwise::uint128 two_root = cxcm::detail::quad_sqrt_digits(two_significand);
+		static_assert(cxcm::detail::quad_sqrt_correct(two_significand, two_root + cxcm::bitwise::uint128{0, 1}) == two_root);
+		static_assert(cxcm::detail::quad_sqrt_correct(two_significand, two_root - cxcm::bitwise::uint128{0, 2}) == two_root);
+
+		// squares of 56-bit integers are exact, so their roots must be too
+		int mismatches = 0;
+		for (std::uint64_t i = 1; i < 100000; ++i)
+		{
+			const std::uint64_t n = (i * 0x9E3779B97F4A7C15) >> 8;
+			const __float128 square = static_cast<__float128>(n) * static_cast<__float128>(n);
+
+			if (cxcm::sqrt(square) != static_cast<__float128>(n))
+				++mismatches;
+
+			if (cxcm::floor(square + quad(0.5)) != square)
+				++mismatches;
+		}
+
+		CHECK(mismatches == 0);
+	}
+}
+
+#endif
+
+#if defined(__STDCPP_FLOAT32_T__) && defined(__STDCPP_FLOAT64_T__)
+
+TEST_SUITE("constexpr_math for C++23 extended floating-point")
+{
+	TEST_CASE("testing cxcm functions with std::float32_t and std::float64_t values")
+	{
+		static_assert(std::is_same_v<cxcm::standard_floating_point_t<std::float32_t>, float>);
+		static_assert(std::is_same_v<cxcm::standard_floating_point_t<std::float64_t>, double>);
+
+		static_assert(cxcm::floor(std::float32_t(-2.5f)) == std::float32_t(-3.0f));
+		static_assert(cxcm::ceil(std::float64_t(-2.5)) == std::float64_t(-2.0));
+		static_assert(cxcm::round_even(std::float64_t(2.5)) == std::float64_t(2.0));
+		static_assert(cxcm::fract(std::float32_t(2.25f)) == std::float32_t(0.25f));
+		static_assert(cxcm::sqrt(std::float64_t(2.0)) == std::float64_t(1.4142135623730951));
+		static_assert(cxcm::relaxed::trunc(std::float32_t(-2.5f)) == std::float32_t(-2.0f));
+		static_assert(cxcm::is_negative_zero(cxcm::negative_zero<std::float64_t>));
+		static_assert(cxcm::isnan(std::numeric_limits<std::float32_t>::quiet_NaN()));
+		static_assert(cxcm::fpclassify(std::numeric_limits<std::float64_t>::denorm_min()) == FP_SUBNORMAL);
+		static_assert(cxcm::signbit(cxcm::copysign(std::float32_t(1.0f), std::float32_t(-0.0f))));
+		static_assert(cxcm::limits::largest_fractional_value<std::float64_t> == std::float64_t(0x1.fffffffffffffp+51));
+
+		std::float32_t value = 7.75f;
+		CHECK(cxcm::floor(value) == std::float32_t(7.0f));
+		CHECK(cxcm::rsqrt(std::float64_t(4.0)) == std::float64_t(0.5));
+	}
+}
+
+#endif
+
+// whether any of isqrt(), icbrt(), and ipow() takes T
+template <typename T>
+concept has_integer_roots = requires(T x) { cxcm::isqrt(x); } || requires(T x) { cxcm::icbrt(x); } || requires(T x) { cxcm::ipow(x, 2u); };
+
 TEST_SUITE("constexpr_math for integral")
 {
 	TEST_CASE("testing cxcm::abs() integral values")
@@ -1213,6 +2634,59 @@ TEST_SUITE("constexpr_math for integral")
 		CHECK(cxcm::round_even(-INT_MAX) == static_cast<double>(-INT_MAX));
 	}
 
+	TEST_CASE("testing cxcm::isqrt(), cxcm::icbrt(), cxcm::ilog2(), cxcm::ipow() integral values")
+	{
+		static_assert(cxcm::isqrt(0xFFFFFFFFFFFFFFFFull) == 0xFFFFFFFFull);
+		static_assert(cxcm::isqrt(0x7FFFFFFFFFFFFFFFll) == 3037000499ll);
+		static_assert(cxcm::icbrt(0xFFFFFFFFFFFFFFFFull) == 2642245ull);
+		static_assert(cxcm::icbrt(std::numeric_limits<long long>::min()) == -2097152ll);
+		static_assert(cxcm::ilog2(std::numeric_limits<unsigned long long>::max()) == 63);
+		static_assert(cxcm::ipow(-2ll, 63) == std::numeric_limits<long long>::min());
+		static_assert(cxcm::ipow(3ull, 40) == 12157665459056928801ull);
+
+		// big * big - 1 rounds up to 2^64 as a double, so going through double is off by one
+		constexpr unsigned long long big = 0xFFFFFFFFull;
+		CHECK_EQ(cxcm::isqrt(big * big - 1), big - 1);
+		CHECK_EQ(cxcm::isqrt(big * big), big);
+		CHECK_EQ(cxcm::icbrt(2097151ull * 2097151ull * 2097151ull - 1), 2097150ull);
+		CHECK_EQ(cxcm::icbrt(-27), -3);
+		CHECK_EQ(cxcm::icbrt(-26), -2);
+		CHECK_EQ(cxcm::ilog2(0), -1);
+		CHECK_EQ(cxcm::ilog2(-5), -1);
+		CHECK_EQ(cxcm::ilog2(1024u), 10);
+		CHECK_EQ(cxcm::ipow(std::int8_t(-2), 7), std::int8_t(-128));
+		CHECK_EQ(cxcm::ipow(0, 0), 1);
+		CHECK_THROWS_AS((void)cxcm::ipow(3, 20), std::domain_error);
+		CHECK_THROWS_AS((void)cxcm::ipow(std::int8_t(-2), 8), std::domain_error);
+		CHECK_THROWS_AS((void)cxcm::isqrt(-1), std::domain_error);
+
+		// 64 bits is the widest they work in, so wider types don't compile rather than lose their high bits
+		static_assert(has_integer_roots<std::int64_t> && has_integer_roots<std::uint64_t>);
+#if defined(__SIZEOF_INT128__)
+		static_assert(!has_integer_roots<__int128> && !has_integer_roots<unsigned __int128>);
+#if defined(__GNUC__) && !defined(__STRICT_ANSI__)
+		static_assert(cxcm::ilog2(static_cast<__int128>(1) << 100) == 100);
+#endif
+#endif
+
+		std::vector<int> values(1000);
+		for (std::size_t i = 0; i < values.size(); ++i)
+			values[i] = static_cast<int>(i * 2147483u);
+
+		std::vector<int> roots(values.size());
+		std::vector<int> logs(values.size());
+		cxcm::batch::isqrt<int>(values, roots);
+		cxcm::batch::ilog2<int>(values, logs);
+		for (std::size_t i = 0; i < values.size(); ++i)
+		{
+			CHECK_EQ(roots[i], cxcm::isqrt(values[i]));
+			CHECK_EQ(logs[i], cxcm::ilog2(values[i]));
+		}
+
+		values[999] = -1;
+		CHECK_THROWS_AS(cxcm::batch::isqrt<int>(values, roots), std::domain_error);
+	}
+
 	TEST_CASE("floating-point negative zero")
 	{
 		CHECK(cxcm::is_negative_zero(cxcm::negative_zero<double>));
@@ -7,6 +7,9 @@
 #include <cstdlib>
 #include "cxcm.hxx"
 #include <iostream>
+#include <chrono>
+#include <vector>
+#include <array>
 
 #define DOCTEST_CONFIG_IMPLEMENT
 
@@ -50,11 +53,25 @@ void test_sqrt_float(unsigned int i, long long &above, long long &below, long lo
 	}
 }
 
-//void print_loop_count_results()
-//{
-//	for (auto [loops, count] : cxcm::relaxed::detail::loop_count_map)
-//		std::printf("%d loops : %d\n", loops, count);
-//}
+// needs CXCM_ENABLE_STATS
+void print_loop_count_results()
+{
+#if defined(CXCM_ENABLE_STATS)
+	const auto counts = cxcm::stats::snapshot();
+
+	for (std::size_t steps = 0; steps < counts.float_sqrt_steps.size(); ++steps)
+	{
+		if (counts.float_sqrt_steps[steps] != 0)
+			std::printf("%zu%s loops : %llu\n", steps, (steps + 1 == counts.float_sqrt_steps.size()) ? "+" : "",
+						static_cast<unsigned long long>(counts.float_sqrt_steps[steps]));
+	}
+
+	std::printf("nan : %llu\n", static_cast<unsigned long long>(counts.nan));
+	std::printf("infinity : %llu\n", static_cast<unsigned long long>(counts.infinity));
+	std::printf("zero : %llu\n", static_cast<unsigned long long>(counts.zero));
+	std::printf("out of range : %llu\n", static_cast<unsigned long long>(counts.out_of_range));
+#endif
+}
 
 
 void test_all_floats_sqrt()
@@ -68,7 +85,7 @@ void test_all_floats_sqrt()
 		test_sqrt_float(i, above, below, same);
 	}
 
-//	print_loop_count_results();
+	print_loop_count_results();
 	std::printf("\n");
 
 	std::printf("same std : %lld\n", same);
@@ -76,6 +93,553 @@ void test_all_floats_sqrt()
 	std::printf("above std : %lld\n", above);
 }
 
+// nanoseconds per value for running f() over count values
+template <typename F>
+double nanoseconds_per_value(std::size_t count, F f)
+{
+	auto start = std::chrono::steady_clock::now();
+	f();
+	auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	return 1.0e9 * seconds / static_cast<double>(count);
+}
+
+// the constexpr long double algorithms run at runtime vs the standard library (glibc on linux)
+void benchmark_long_double()
+{
+	std::vector<long double> values(1 << 22);
+	for (std::size_t i = 0; i < values.size(); ++i)
+		values[i] = std::ldexp(static_cast<long double>(i * 2654435761u % 1000003) + 0.37L, static_cast<int>(i % 64) - 32);
+
+	std::vector<long double> results(values.size());
+	auto run = [&](const char *name, auto f)
+	{
+		double ns = nanoseconds_per_value(values.size(), [&]() { for (std::size_t i = 0; i < values.size(); ++i) results[i] = f(values[i]); });
+		std::printf("%-28s : %7.3f ns/value\n", name, ns);
+	};
+
+	run("cxcm constexpr_trunc", [](long double x) { return cxcm::detail::constexpr_trunc(x); });
+	run("std::trunc", [](long double x) { return std::trunc(x); });
+	run("cxcm constexpr_floor", [](long double x) { return cxcm::detail::constexpr_floor(x); });
+	run("std::floor", [](long double x) { return std::floor(x); });
+	run("cxcm constexpr_round", [](long double x) { return cxcm::detail::constexpr_round(x); });
+	run("std::round", [](long double x) { return std::round(x); });
+	run("cxcm extended_sqrt", [](long double x) { return cxcm::relaxed::detail::extended_sqrt(x); });
+	run("std::sqrt", [](long double x) { return std::sqrt(x); });
+	run("cxcm fpclassify", [](long double x) { return static_cast<long double>(cxcm::fpclassify(x)); });
+	run("std::fpclassify", [](long double x) { return static_cast<long double>(std::fpclassify(x)); });
+}
+
+// runtime table lookup over 16-bit floats vs converting to float and calling the function
+void benchmark_half_table()
+{
+	auto f = [](float x) { return std::tanh(x); };
+	static const auto table = cxcm::make_half_table<cxcm::float16>(f);
+
+	std::vector<cxcm::float16> values(1 << 24);
+	for (std::size_t i = 0; i < values.size(); ++i)
+		values[i] = cxcm::float16::from_bits(static_cast<std::uint16_t>(i * 2654435761u >> 16));
+
+	std::vector<float> results(values.size());
+
+	auto start = std::chrono::steady_clock::now();
+	cxcm::batch::lookup(table, values, results);
+	auto table_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	float table_check = results[results.size() / 3];
+
+	start = std::chrono::steady_clock::now();
+	for (std::size_t i = 0; i < values.size(); ++i)
+		results[i] = f(static_cast<float>(values[i]));
+	auto direct_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::printf("half table lookup : %.3f ns/value\n", 1.0e9 * table_time / static_cast<double>(values.size()));
+	std::printf("convert and call  : %.3f ns/value\n", 1.0e9 * direct_time / static_cast<double>(values.size()));
+	std::printf("same result       : %s\n", (table_check == results[results.size() / 3]) ? "yes" : "no");
+}
+
+// batch conversions to and from 16-bit floating-point, vs one value at a time. build with -mf16c, -mavx2
+// or -mavx512f to get the vector paths. the large case is bound by memory bandwidth.
+void benchmark_half_convert()
+{
+	for (std::size_t count : {std::size_t(1) << 12, std::size_t(1) << 24})
+	{
+		std::vector<float> values(count);
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = static_cast<float>(i * 2654435761u % 100003) * 0.01f - 500.0f;
+
+		std::vector<cxcm::float16> halves(count);
+		std::vector<cxcm::bfloat16> brains(count);
+		std::vector<float> results(count);
+		std::size_t repeat = (std::size_t(1) << 26) / count;
+
+		auto run = [&](const char *name, auto f)
+		{
+			double ns = nanoseconds_per_value(count * repeat, [&]() { for (std::size_t r = 0; r < repeat; ++r) f(); });
+			std::printf("%-10zu %-24s : %6.3f ns/value\n", count, name, ns);
+		};
+
+		run("float to float16", [&]() { cxcm::batch::convert(values, halves); });
+		run("float to float16 scalar", [&]() { for (std::size_t i = 0; i < count; ++i) halves[i] = cxcm::float16(values[i]); });
+		run("float16 to float", [&]() { cxcm::batch::convert(halves, results); });
+		run("float to bfloat16", [&]() { cxcm::batch::convert(values, brains); });
+		run("float to bfloat16 scalar", [&]() { for (std::size_t i = 0; i < count; ++i) brains[i] = cxcm::bfloat16(values[i]); });
+		run("bfloat16 to float", [&]() { cxcm::batch::convert(brains, results); });
+	}
+}
+
+void benchmark_grid_index()
+{
+	for (std::size_t count : {std::size_t(1) << 12, std::size_t(1) << 24})
+	{
+		std::vector<float> values(count);
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = static_cast<float>(i * 2654435761u % 100003) * 0.013f - 600.0f;
+
+		std::vector<int> cells(count);
+		std::size_t repeat = (std::size_t(1) << 26) / count;
+
+		auto run = [&](const char *name, auto f)
+		{
+			double ns = nanoseconds_per_value(count * repeat, [&]() { for (std::size_t r = 0; r < repeat; ++r) f(); });
+			std::printf("%-10zu %-32s : %6.3f ns/value\n", count, name, ns);
+		};
+
+		run("static_cast<int>(cxcm::floor(x))", [&]() { for (std::size_t i = 0; i < count; ++i) cells[i] = static_cast<int>(cxcm::floor(values[i])); });
+		run("cxcm::ifloor(x)", [&]() { for (std::size_t i = 0; i < count; ++i) cells[i] = cxcm::ifloor(values[i]); });
+		run("cxcm::batch::ifloor()", [&]() { cxcm::batch::ifloor<int, float>(values, cells); });
+	}
+}
+
+// wrapping angles and phases into one period, the same divisor every time
+void benchmark_fmod()
+{
+	for (std::size_t count : {std::size_t(1) << 12, std::size_t(1) << 24})
+	{
+		std::vector<double> values(count);
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = static_cast<double>(i * 2654435761u % 1000003) * 0.0137 - 6000.0;
+
+		std::vector<double> results(count);
+		std::size_t repeat = (std::size_t(1) << 26) / count;
+		const double period = 6.283185307179586;
+
+		auto run = [&](const char *name, auto f)
+		{
+			double ns = nanoseconds_per_value(count * repeat, [&]() { for (std::size_t r = 0; r < repeat; ++r) f(); });
+			std::printf("%-10zu %-24s : %6.3f ns/value\n", count, name, ns);
+		};
+
+		run("std::fmod(x, period)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = std::fmod(values[i], period); });
+		run("cxcm::batch::fmod()", [&]() { cxcm::batch::fmod<double>(values, period, results); });
+	}
+}
+
+// angles into [-pi, pi), with fmod and an adjustment, against cxcm::periodic
+void benchmark_periodic()
+{
+	constexpr double pi = 3.141592653589793;
+	constexpr auto angles = cxcm::make_periodic(-pi, pi);
+
+	for (std::size_t count : {std::size_t(1) << 12, std::size_t(1) << 24})
+	{
+		std::vector<double> values(count);
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = static_cast<double>(i * 2654435761u % 1000003) * 0.0137 - 6000.0;
+
+		std::vector<double> results(count);
+		std::size_t repeat = (std::size_t(1) << 26) / count;
+
+		auto run = [&](const char *name, auto f)
+		{
+			double ns = nanoseconds_per_value(count * repeat, [&]() { for (std::size_t r = 0; r < repeat; ++r) f(); });
+			std::printf("%-10zu %-24s : %6.3f ns/value\n", count, name, ns);
+		};
+
+		run("std::fmod() wrap", [&]()
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				double r = std::fmod(values[i] + pi, 2 * pi);
+				results[i] = ((r < 0) ? r + 2 * pi : r) - pi;
+			}
+		});
+		run("periodic::wrap()", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = angles.wrap(values[i]); });
+		run("cxcm::batch::wrap()", [&]() { cxcm::batch::wrap<double>(angles, values, results); });
+	}
+}
+
+// the batch rounding, sqrt, and classification kernels. run it with CXCM_FORCE_TIER=avx2 and again without it to
+// compare the AVX2 and AVX-512 kernels.
+void benchmark_elementwise()
+{
+	std::printf("active tier: %s\n", cxcm::batch::tier_name(cxcm::batch::active_tier()).data());
+
+	for (std::size_t count : {std::size_t(1) << 12, std::size_t(1) << 24})
+	{
+		std::vector<float> values(count);
+		for (std::size_t i = 0; i < count; ++i)
+			values[i] = static_cast<float>(i * 2654435761u % 1000003) * 0.0137f + 0.001f;
+
+		std::vector<float> results(count);
+		std::vector<int> classes(count);
+		std::size_t repeat = (std::size_t(1) << 26) / count;
+
+		auto run = [&](const char *name, auto f)
+		{
+			double ns = nanoseconds_per_value(count * repeat, [&]() { for (std::size_t r = 0; r < repeat; ++r) f(); });
+			std::printf("%-10zu %-28s : %6.3f ns/value\n", count, name, ns);
+		};
+
+		run("cxcm::round(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::round(values[i]); });
+		run("cxcm::batch::round()", [&]() { cxcm::batch::round<float>(values, results); });
+		run("cxcm::batch::round_even()", [&]() { cxcm::batch::round_even<float>(values, results); });
+		run("cxcm::batch::floor()", [&]() { cxcm::batch::floor<float>(values, results); });
+		run("cxcm::fract(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::fract(values[i]); });
+		run("cxcm::batch::fract()", [&]() { cxcm::batch::fract<float>(values, results); });
+		run("cxcm::rsqrt(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::rsqrt(values[i]); });
+		run("cxcm::batch::rsqrt()", [&]() { cxcm::batch::rsqrt<float>(values, results); });
+		run("cxcm::fpclassify(x)", [&]() { for (std::size_t i = 0; i < count; ++i) classes[i] = cxcm::fpclassify(values[i]); });
+		run("cxcm::batch::fpclassify()", [&]() { cxcm::batch::fpclassify<float>(values, classes); });
+	}
+}
+
+// the worst error of approx<Bits> over every float each function takes, in bits, i.e., -log2 of the largest relative
+// error (relative to max(1, |log2(x)|) for log2). each needs to be at least Bits. the references are the double
+// versions, which are far more accurate than anything being checked.
+template <int Bits>
+void test_all_floats_approx()
+{
+	using approx = cxcm::approx<Bits>;
+
+	double sqrt_error = 0.0;
+	double rsqrt_error = 0.0;
+	double recip_error = 0.0;
+	double log2_error = 0.0;
+	double exp2_error = 0.0;
+
+	// positive normal values, and their negatives for recip() up to 2^125
+	for (unsigned int i = 0x00800000; i < 0x7F800000; ++i)
+	{
+		float x = std::bit_cast<float>(i);
+		double d = x;
+		double root = std::sqrt(d);
+
+		sqrt_error = std::max(sqrt_error, std::abs(approx::sqrt(x) / root - 1.0));
+		rsqrt_error = std::max(rsqrt_error, std::abs(approx::rsqrt(x) * root - 1.0));
+
+		double log = std::log2(d);
+		log2_error = std::max(log2_error, std::abs(approx::log2(x) - log) / std::max(1.0, std::abs(log)));
+
+		if (i < 0x7E000000)
+		{
+			recip_error = std::max(recip_error, std::abs(approx::recip(x) * d - 1.0));
+			recip_error = std::max(recip_error, std::abs(approx::recip(-x) * -d - 1.0));
+		}
+	}
+
+	// every float from -126 to 127, down to the smallest subnormals
+	auto exp2_check = [&](unsigned int first, unsigned int last)
+	{
+		for (unsigned int i = first; i <= last; ++i)
+		{
+			float x = std::bit_cast<float>(i);
+			exp2_error = std::max(exp2_error, std::abs(approx::exp2(x) / std::exp2(static_cast<double>(x)) - 1.0));
+		}
+	};
+
+	exp2_check(0x00000000, std::bit_cast<unsigned int>(127.0f));
+	exp2_check(0x80000000, std::bit_cast<unsigned int>(-126.0f));
+
+	auto bits = [](double error) { return (error == 0.0) ? 99.0 : -std::log2(error); };
+	std::printf("approx<%2d> float bits - sqrt: %5.2f  rsqrt: %5.2f  recip: %5.2f  exp2: %5.2f  log2: %5.2f   steps %d %d %d, degrees %d %d\n",
+				Bits, bits(sqrt_error), bits(rsqrt_error), bits(recip_error), bits(exp2_error), bits(log2_error),
+				approx::template sqrt_steps<float>, approx::template rsqrt_steps<float>, approx::template recip_steps<float>,
+				approx::template exp2_degree<float>, approx::template log2_degree<float>);
+}
+
+void test_all_floats_approx()
+{
+	test_all_floats_approx<4>();
+	test_all_floats_approx<8>();
+	test_all_floats_approx<12>();
+	test_all_floats_approx<16>();
+	test_all_floats_approx<20>();
+	test_all_floats_approx<23>();
+}
+
+// approx<12> and approx<20> against the exact versions, a block at a time
+void benchmark_approx()
+{
+	constexpr std::size_t count = std::size_t(1) << 12;
+	constexpr std::size_t repeat = std::size_t(1) << 14;
+
+	std::vector<float> values(count);
+	for (std::size_t i = 0; i < count; ++i)
+		values[i] = static_cast<float>(i * 2654435761u % 1000003) * 0.0137f + 0.001f;
+
+	std::vector<float> results(count);
+
+	auto run = [&](const char *name, auto f)
+	{
+		double ns = nanoseconds_per_value(count * repeat, [&]() { for (std::size_t r = 0; r < repeat; ++r) f(); });
+		std::printf("%-36s : %6.3f ns/value\n", name, ns);
+	};
+
+	run("cxcm::batch::rsqrt()", [&]() { cxcm::batch::rsqrt<float>(values, results); });
+	run("cxcm::batch::approx<20>::rsqrt()", [&]() { cxcm::batch::approx<20>::rsqrt<float>(values, results); });
+	run("cxcm::batch::approx<12>::rsqrt()", [&]() { cxcm::batch::approx<12>::rsqrt<float>(values, results); });
+	run("cxcm::batch::sqrt()", [&]() { cxcm::batch::sqrt<float>(values, results); });
+	run("cxcm::batch::approx<12>::sqrt()", [&]() { cxcm::batch::approx<12>::sqrt<float>(values, results); });
+	run("1 / x", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = 1.0f / values[i]; });
+	run("cxcm::batch::approx<12>::recip()", [&]() { cxcm::batch::approx<12>::recip<float>(values, results); });
+	run("std::log2(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = std::log2(values[i]); });
+	run("cxcm::batch::approx<20>::log2()", [&]() { cxcm::batch::approx<20>::log2<float>(values, results); });
+	run("cxcm::batch::approx<12>::log2()", [&]() { cxcm::batch::approx<12>::log2<float>(values, results); });
+
+	for (std::size_t i = 0; i < count; ++i)
+		values[i] = static_cast<float>(i * 2654435761u % 1000003) * 0.0002f - 100.0f;
+
+	run("std::exp2(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = std::exp2(values[i]); });
+	run("cxcm::batch::approx<20>::exp2()", [&]() { cxcm::batch::approx<20>::exp2<float>(values, results); });
+	run("cxcm::batch::approx<12>::exp2()", [&]() { cxcm::batch::approx<12>::exp2<float>(values, results); });
+}
+
+// every float through the reproducible_policy runtime versions, scalar and batch, against the constexpr algorithms
+// run at runtime, bit for bit
+void test_all_floats_reproducible()
+{
+	constexpr std::size_t block = std::size_t(1) << 24;
+
+	std::vector<float> values(block);
+	std::vector<float> expected(block);
+	std::vector<float> scalar(block);
+	std::vector<float> batch(block);
+
+	auto run = [&](const char *name, auto algorithm, auto reproducible, auto batch_reproducible)
+	{
+		long long scalar_mismatches = 0;
+		long long batch_mismatches = 0;
+
+		for (std::uint64_t start = 0; start < (std::uint64_t(1) << 32); start += block)
+		{
+			for (std::size_t i = 0; i < block; ++i)
+				values[i] = std::bit_cast<float>(static_cast<unsigned int>(start + i));
+
+			for (std::size_t i = 0; i < block; ++i)
+			{
+				expected[i] = algorithm(values[i]);
+				scalar[i] = reproducible(values[i]);
+			}
+
+			batch_reproducible(values, batch);
+
+			for (std::size_t i = 0; i < block; ++i)
+			{
+				const unsigned int bits = std::bit_cast<unsigned int>(expected[i]);
+				if (bits != std::bit_cast<unsigned int>(scalar[i]))
+				{
+					if (scalar_mismatches++ < 4)
+						std::printf("  %s(%a) scalar: %a, expected %a\n", name, values[i], scalar[i], expected[i]);
+				}
+				if (bits != std::bit_cast<unsigned int>(batch[i]))
+				{
+					if (batch_mismatches++ < 4)
+						std::printf("  %s(%a) batch: %a, expected %a\n", name, values[i], batch[i], expected[i]);
+				}
+			}
+		}
+
+		std::printf("%-12s scalar mismatches : %lld, batch mismatches : %lld\n", name, scalar_mismatches, batch_mismatches);
+		std::fflush(stdout);
+	};
+
+	using cxcm::reproducible_policy;
+	run("trunc", [](float x) { return cxcm::detail::constexpr_trunc(x); }, [](float x) { return cxcm::trunc<reproducible_policy>(x); },
+		[](const std::vector<float> &v, std::vector<float> &r) { cxcm::batch::trunc<reproducible_policy, float>(v, r); });
+	run("floor", [](float x) { return cxcm::detail::constexpr_floor(x); }, [](float x) { return cxcm::floor<reproducible_policy>(x); },
+		[](const std::vector<float> &v, std::vector<float> &r) { cxcm::batch::floor<reproducible_policy, float>(v, r); });
+	run("ceil", [](float x) { return cxcm::detail::constexpr_ceil(x); }, [](float x) { return cxcm::ceil<reproducible_policy>(x); },
+		[](const std::vector<float> &v, std::vector<float> &r) { cxcm::batch::ceil<reproducible_policy, float>(v, r); });
+	run("round", [](float x) { return cxcm::detail::constexpr_round(x); }, [](float x) { return cxcm::round<reproducible_policy>(x); },
+		[](const std::vector<float> &v, std::vector<float> &r) { cxcm::batch::round<reproducible_policy, float>(v, r); });
+	run("round_even", [](float x) { return cxcm::detail::constexpr_round_even(x); }, [](float x) { return cxcm::round_even<reproducible_policy>(x); },
+		[](const std::vector<float> &v, std::vector<float> &r) { cxcm::batch::round_even<reproducible_policy, float>(v, r); });
+	run("fract", [](float x) { return cxcm::detail::constexpr_fract(x); }, [](float x) { return cxcm::fract<reproducible_policy>(x); },
+		[](const std::vector<float> &v, std::vector<float> &r) { cxcm::batch::fract<reproducible_policy, float>(v, r); });
+	run("sqrt", [](float x) { return cxcm::detail::constexpr_sqrt(x); }, [](float x) { return cxcm::sqrt<reproducible_policy>(x); },
+		[](const std::vector<float> &v, std::vector<float> &r) { cxcm::batch::sqrt<reproducible_policy, float>(v, r); });
+	run("rsqrt", [](float x) { return cxcm::detail::constexpr_rsqrt(x); }, [](float x) { return cxcm::rsqrt<reproducible_policy>(x); },
+		[](const std::vector<float> &v, std::vector<float> &r) { cxcm::batch::rsqrt<reproducible_policy, float>(v, r); });
+}
+
+// the constexpr algorithms run at runtime vs the reproducible_policy versions, which give the same bits
+void benchmark_reproducible()
+{
+	constexpr std::size_t count = std::size_t(1) << 12;
+	constexpr std::size_t repeat = std::size_t(1) << 10;
+
+	std::vector<double> values(count);
+	for (std::size_t i = 0; i < count; ++i)
+		values[i] = static_cast<double>(i * 2654435761u % 1000003) * 0.0137 + 0.001;
+
+	std::vector<double> results(count);
+
+	auto run = [&](const char *name, auto f)
+	{
+		double ns = nanoseconds_per_value(count * repeat, [&]() { for (std::size_t r = 0; r < repeat; ++r) f(); });
+		std::printf("%-44s : %7.3f ns/value\n", name, ns);
+	};
+
+	using cxcm::reproducible_policy;
+	run("cxcm::detail::constexpr_floor(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::detail::constexpr_floor(values[i]); });
+	run("cxcm::floor<reproducible_policy>(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::floor<reproducible_policy>(values[i]); });
+	run("cxcm::batch::floor<reproducible_policy>()", [&]() { cxcm::batch::floor<reproducible_policy, double>(values, results); });
+	run("cxcm::detail::constexpr_round_even(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::detail::constexpr_round_even(values[i]); });
+	run("cxcm::round_even<reproducible_policy>(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::round_even<reproducible_policy>(values[i]); });
+	run("cxcm::detail::constexpr_fract(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::detail::constexpr_fract(values[i]); });
+	run("cxcm::fract<reproducible_policy>(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::fract<reproducible_policy>(values[i]); });
+	run("cxcm::detail::constexpr_fmod(x, 0.37)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::detail::constexpr_fmod(values[i], 0.37); });
+	run("cxcm::fmod<reproducible_policy>(x, 0.37)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::fmod<reproducible_policy>(values[i], 0.37); });
+	run("cxcm::detail::constexpr_sqrt(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::detail::constexpr_sqrt(values[i]); });
+	run("cxcm::sqrt<reproducible_policy>(x)", [&]() { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::sqrt<reproducible_policy>(values[i]); });
+	run("cxcm::batch::sqrt<reproducible_policy>()", [&]() { cxcm::batch::sqrt<reproducible_policy, double>(values, results); });
+}
+
+// subnormal input costs many cpus a microcode assist per operation. the same values all normal, then with 7 in 8
+// of them scaled down to subnormals, and those again with FTZ and DAZ set. the flushed batch functions take the
+// subnormals as zeros without MXCSR.
+void benchmark_subnormals()
+{
+	constexpr std::size_t count = std::size_t(1) << 12;
+	constexpr std::size_t repeat = std::size_t(1) << 8;
+
+	std::vector<double> normal(count);
+	std::vector<double> subnormal(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		normal[i] = static_cast<double>(i * 2654435761u % 1000003) * 0.0137 + 0.001;
+		subnormal[i] = (i % 8 == 0) ? normal[i] : normal[i] * 0x1.0p-1050;
+	}
+
+	std::vector<double> results(count);
+
+	auto run = [&](const char *name, auto f)
+	{
+		auto time = [&](const std::vector<double> &values)
+		{
+			return nanoseconds_per_value(count * repeat, [&]() { for (std::size_t r = 0; r < repeat; ++r) f(values); });
+		};
+
+		const double normal_ns = time(normal);
+		const double subnormal_ns = time(subnormal);
+		double flushed_ns = 0.0;
+		{
+			const cxcm::flush_denormals_scope flush;
+			flushed_ns = time(subnormal);
+		}
+
+		std::printf("%-44s : %8.3f normal, %8.3f subnormal, %8.3f FTZ/DAZ ns/value\n", name, normal_ns, subnormal_ns, flushed_ns);
+	};
+
+	constexpr auto flush = cxcm::batch::subnormals::flush;
+	run("cxcm::sqrt(x)", [&](const std::vector<double> &v) { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::sqrt(v[i]); });
+	run("cxcm::rsqrt(x)", [&](const std::vector<double> &v) { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::rsqrt(v[i]); });
+	run("cxcm::fast_rsqrt(x)", [&](const std::vector<double> &v) { for (std::size_t i = 0; i < count; ++i) results[i] = cxcm::fast_rsqrt(v[i]); });
+	run("cxcm::batch::floor<double>()", [&](const std::vector<double> &v) { cxcm::batch::floor<double>(v, results); });
+	run("cxcm::batch::floor<double, flush>()", [&](const std::vector<double> &v) { cxcm::batch::floor<double, flush>(v, results); });
+	run("cxcm::batch::sqrt<double>()", [&](const std::vector<double> &v) { cxcm::batch::sqrt<double>(v, results); });
+	run("cxcm::batch::sqrt<double, flush>()", [&](const std::vector<double> &v) { cxcm::batch::sqrt<double, flush>(v, results); });
+	run("cxcm::batch::rsqrt<double>()", [&](const std::vector<double> &v) { cxcm::batch::rsqrt<double>(v, results); });
+	run("cxcm::batch::rsqrt<double, flush>()", [&](const std::vector<double> &v) { cxcm::batch::rsqrt<double, flush>(v, results); });
+}
+
+// needs CXCM_ENABLE_PATH_STATS. a loop that mixes the std:: backed functions, the cxcm algorithms at runtime, and a
+// batch function, then the report of where the values went.
+void report_runtime_paths()
+{
+#if defined(CXCM_ENABLE_PATH_STATS)
+	std::vector<double> values(1 << 16);
+	for (std::size_t i = 0; i < values.size(); ++i)
+		values[i] = static_cast<double>(i * 2654435761u % 1000003) * 0.0137 + 0.001;
+
+	std::vector<double> results(values.size());
+	for (std::size_t i = 0; i < values.size(); ++i)
+		results[i] = cxcm::floor(values[i]) + cxcm::fract(values[i]) * cxcm::rsqrt(values[i]);
+
+	cxcm::batch::round_even<double>(values, results);
+
+	std::printf("%s", cxcm::stats::path_report().c_str());
+#endif
+}
+
+#if defined(CXCM_HAS_FLOAT128)
+
+// binary128 at runtime vs dd_real doing the same jobs (floor of the high word fixed up by the low word, and the
+// QD library's one step sqrt). build with -DCXCM_USE_QUADMATH -lquadmath to add libquadmath.
+void benchmark_float128()
+{
+	std::vector<__float128> values(1 << 20);
+	std::vector<cxcm::dd_real::dd_real> dd_values(values.size());
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		double high = std::ldexp(static_cast<double>(i * 2654435761u % 1000003) + 0.37, static_cast<int>(i % 64) - 20);
+		double low = high * 0x1.0p-60;
+		values[i] = static_cast<__float128>(high) + static_cast<__float128>(low);
+		dd_values[i] = cxcm::dd_real::dd_real(high, low);
+	}
+
+	std::vector<__float128> results(values.size());
+	std::vector<cxcm::dd_real::dd_real> dd_results(values.size());
+
+	auto run = [&](const char *name, auto f)
+	{
+		double ns = nanoseconds_per_value(values.size(), f);
+		std::printf("%-24s : %7.3f ns/value\n", name, ns);
+	};
+
+	auto dd_floor = [](const cxcm::dd_real::dd_real &a)
+	{
+		double high = std::floor(a[0]);
+		return (high == a[0]) ? cxcm::dd_real::dd_real(high, std::floor(a[1])) : cxcm::dd_real::dd_real(high, 0.0);
+	};
+
+	auto dd_sqrt = [](const cxcm::dd_real::dd_real &a)
+	{
+		double x = 1.0 / std::sqrt(a[0]);
+		double ax = a[0] * x;
+		return cxcm::dd_real::dd_real(ax) + (a - cxcm::dd_real::dd_real(ax) * ax)[0] * (x * 0.5);
+	};
+
+	run("cxcm floor __float128", [&]() { for (std::size_t i = 0; i < values.size(); ++i) results[i] = cxcm::floor(values[i]); });
+	run("cxcm sqrt __float128", [&]() { for (std::size_t i = 0; i < values.size(); ++i) results[i] = cxcm::sqrt(values[i]); });
+#if defined(CXCM_USE_QUADMATH)
+	run("floorq", [&]() { for (std::size_t i = 0; i < values.size(); ++i) results[i] = floorq(values[i]); });
+	run("sqrtq", [&]() { for (std::size_t i = 0; i < values.size(); ++i) results[i] = sqrtq(values[i]); });
+#endif
+	run("dd_real floor", [&]() { for (std::size_t i = 0; i < values.size(); ++i) dd_results[i] = dd_floor(dd_values[i]); });
+	run("dd_real sqrt", [&]() { for (std::size_t i = 0; i < values.size(); ++i) dd_results[i] = dd_sqrt(dd_values[i]); });
+}
+
+#endif
+
+#if defined(CXCM_COMPILE_TIME_BENCHMARK)
+
+// compile-time benchmark. time the build of this file with -DCXCM_COMPILE_TIME_BENCHMARK, with and without
+// -DCXCM_NO_CONSTEXPR_BUILTINS, to compare gcc's builtins against the cxcm algorithms in constant evaluation.
+constexpr auto compile_time_table = []
+{
+	std::array<double, 4096> values{};
+	for (std::size_t i = 0; i < values.size(); ++i)
+	{
+		const double x = static_cast<double>(i);
+		values[i] = cxcm::sqrt(x + 0.37) + cxcm::floor(x * 0.37) + cxcm::fmod(x * 1.37, 3.0);
+	}
+
+	return values;
+}();
+
+#endif
+
 // this function is a place to just test out whatever
 void sandbox_function()
 {
@@ -90,6 +654,20 @@ void sandbox_function()
 
 
 //	test_all_floats_sqrt();
+//	benchmark_half_table();
+//	benchmark_half_convert();
+//	benchmark_grid_index();
+//	benchmark_fmod();
+//	benchmark_periodic();
+//	benchmark_elementwise();
+//	test_all_floats_approx();
+//	benchmark_approx();
+//	test_all_floats_reproducible();
+//	benchmark_reproducible();
+//	benchmark_subnormals();
+//	report_runtime_paths();
+//	benchmark_float128();
+//	benchmark_long_double();
 }
 
 int main(int argc, char *argv[])